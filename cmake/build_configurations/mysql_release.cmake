@@ -83,6 +83,7 @@ IF(FEATURE_SET)
 ENDIF()
 
 SET(WITH_INNODB_SNAPPY OFF CACHE STRING "")
+SET(WITH_INNODB_ZSTD OFF CACHE STRING "")
 SET(WITH_NUMA 0 CACHE BOOL "")
 SET(CPU_LEVEL1_DCACHE_LINESIZE 0)
 
@@ -318,6 +318,7 @@ SET(HAVE_BZLIB2_COMPRESS CACHE INTERNAL "")
 SET(HAVE_BZLIB2_DECOMPRESS CACHE INTERNAL "")
 SET(HAVE_BZLIB2_H CACHE INTERNAL "")
 SET(HAVE_SNAPPY_H CACHE INTERNAL "")
+SET(HAVE_ZSTD_H CACHE INTERNAL "")
 SET(HAVE_SCHED_GETCPU CACHE INTERNAL "")
 SET(HAVE_PTHREAD_THREADID_NP CACHE INTERNAL "")
 SET(HAVE_SYS_GETTID CACHE INTERNAL "")
@@ -334,6 +335,7 @@ SET(HAVE_GETPWUID_POSIX_FINAL CACHE INTERNAL "")
 SET(HAVE_CRACK_H CACHE INTERNAL "")
 SET(HAVE_LIBCRACK CACHE INTERNAL "")
 SET(HAVE_SNAPPY_SHARED_LIB INTERNAL "")
+SET(HAVE_ZSTD_SHARED_LIB INTERNAL "")
 SET(HAVE_LZ4_SHARED_LIB INTERNAL "")
 SET(HAVE_SYS_POLL_H CACHE  INTERNAL "")
 SET(HAVE_SYS_SYSCALL_H CACHE  INTERNAL "")
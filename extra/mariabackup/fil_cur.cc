@@ -32,6 +32,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1335  USA
 #include "fil_cur.h"
 #include "fil0crypt.h"
 #include "fil0pagecompress.h"
+#include "buf0checksum.h"
 #include "common.h"
 #include "read_filt.h"
 #include "xtrabackup.h"
@@ -242,9 +243,17 @@ xb_fil_cur_open(
 	return(XB_FIL_CUR_SUCCESS);
 }
 
+/** Check whether a page that was read by xb_fil_cur_read() is corrupted.
+@param page     the page
+@param page_no  page number
+@param cursor   source file cursor
+@param space    tablespace
+@param crc32    checksum computed by buf_calc_pages_full_crc32(), or nullptr
+@return whether the page is corrupted */
 static bool page_is_corrupted(const byte *page, ulint page_no,
 			      const xb_fil_cur_t *cursor,
-			      const fil_space_t *space)
+			      const fil_space_t *space,
+			      const uint32_t *crc32)
 {
 	byte tmp_frame[UNIV_PAGE_SIZE_MAX];
 	byte tmp_page[UNIV_PAGE_SIZE_MAX];
@@ -286,7 +295,7 @@ static bool page_is_corrupted(const byte *page, ulint page_no,
 	}
 
 	if (space->full_crc32()) {
-		return buf_page_is_corrupted(true, page, space->flags);
+		return buf_page_is_corrupted(true, page, space->flags, crc32);
 	}
 
 	/* Validate encrypted pages. The first page is never encrypted.
@@ -365,6 +374,8 @@ xb_fil_cur_result_t xb_fil_cur_read(xb_fil_cur_t*	cursor,
 	ib_int64_t		to_read;
 	const ulint		page_size = cursor->page_size;
 	bool			defer = false;
+	uint32_t		crc32[XB_FIL_CUR_PAGES];
+	bool			crc32_valid;
 	xb_ad(!cursor->is_system() || page_size == srv_page_size);
 
 	cursor->read_filter->get_next_batch(&cursor->read_filter_ctxt,
@@ -421,13 +432,22 @@ xb_fil_cur_result_t xb_fil_cur_read(xb_fil_cur_t*	cursor,
 	}
 
 	defer = space->is_deferred();
+	/* Compute the checksums of all pages at once, interleaving the
+	computations. */
+	crc32_valid = !defer && space->full_crc32();
+	if (crc32_valid) {
+		xb_ad(page_size == srv_page_size);
+		buf_calc_pages_full_crc32(cursor->buf, npages, crc32);
+	}
 	/* check pages for corruption and re-read if necessary. i.e. in case of
 	partially written pages */
 	for (page = cursor->buf, i = 0; i < npages;
 	     page += page_size, i++) {
 		unsigned page_no = cursor->buf_page_no + i;
 
-		if (!defer && page_is_corrupted(page, page_no, cursor, space)) {
+		if (!defer
+		    && page_is_corrupted(page, page_no, cursor, space,
+					 crc32_valid ? &crc32[i] : nullptr)) {
 			retry_count--;
 
 			if (retry_count == 0) {
@@ -918,6 +918,9 @@ extern int unpackfrm(uchar **, size_t *, const uchar *);
 
 extern uint32 my_checksum(uint32, const void *, size_t);
 extern uint32 my_crc32c(uint32, const void *, size_t);
+/* CRC-32C of n buffers of size bytes that are stride bytes apart */
+extern void my_crc32c_multi(uint32 *crc, const void *buf, size_t size,
+                            size_t stride, size_t n);
 
 extern const char *my_crc32c_implementation();
 
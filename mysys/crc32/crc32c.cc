@@ -43,6 +43,11 @@ static inline uint32_t DecodeFixed32(const char *ptr)
 #   include <nmmintrin.h>
 #  endif
 #  define USE_SSE42 __attribute__((target("sse4.2")))
+#  if defined HAVE_PCLMUL && SIZEOF_SIZE_T == 8 && \
+  (defined __clang__ ? __clang_major__ >= 8 : __GNUC__ >= 8)
+#   define HAVE_VPCLMULQDQ
+#   include <immintrin.h>
+#  endif
 # else
 #  define USE_SSE42 /* nothing */
 # endif
@@ -483,6 +488,124 @@ static uint32_t crc32c_sse42(uint32_t crc, const char* buf, size_t size)
     STEP1;
   return static_cast<uint32_t>(l ^ 0xffffffffu);
 }
+
+# ifdef HAVE_VPCLMULQDQ
+#  define USE_VPCLMULQDQ \
+  __attribute__((target("sse4.2,pclmul,avx512f,vpclmulqdq")))
+
+/** @return whether AVX-512F and VPCLMULQDQ are available */
+static bool have_vpclmulqdq()
+{
+  uint32_t reax= 0, rebx= 0, recx= 0, redx= 0;
+  if (__get_cpuid_max(0, nullptr) < 7)
+    return false;
+  __cpuid(1, reax, rebx, recx, redx);
+  /* OSXSAVE, PCLMUL, SSE4.2 */
+  if (~recx & (1U << 27 | cpuid_ecx_SSE42_AND_PCLMUL))
+    return false;
+  uint32_t xcr0, xcr0_hi;
+  __asm__("xgetbv" : "=a"(xcr0), "=d"(xcr0_hi) : "c"(0));
+  /* The operating system must preserve the SSE, AVX, opmask and
+  ZMM registers. */
+  if ((xcr0 & 0xe6) != 0xe6)
+    return false;
+  __cpuid_count(7, 0, reax, rebx, recx, redx);
+  /* AVX512F, VPCLMULQDQ */
+  return (rebx & 1U << 16) && (recx & 1U << 10);
+}
+
+/* Constants for folding a 128-bit lane forward by n bits in the
+bit-reflected domain: the low 64 bits of the lane are multiplied by
+x^(n+63) mod P and the high 64 bits by x^(n-1) mod P, where P is the
+CRC-32C polynomial 0x11EDC6F41. The remainders are stored bit-reflected
+in the most significant half of each 64-bit constant. */
+static constexpr uint64_t crc32c_fold_128_lo= 0x3743f7bd00000000;
+static constexpr uint64_t crc32c_fold_128_hi= 0x3171d43000000000;
+static constexpr uint64_t crc32c_fold_256_lo= 0x33ccbbbc00000000;
+static constexpr uint64_t crc32c_fold_256_hi= 0xa2158b3400000000;
+static constexpr uint64_t crc32c_fold_384_lo= 0xa46ef4aa00000000;
+static constexpr uint64_t crc32c_fold_384_hi= 0x6051243f00000000;
+static constexpr uint64_t crc32c_fold_512_lo= 0x1c19243b00000000;
+static constexpr uint64_t crc32c_fold_512_hi= 0x75bba45b00000000;
+static constexpr uint64_t crc32c_fold_1024_lo= 0x6577b24500000000;
+static constexpr uint64_t crc32c_fold_1024_hi= 0x7417153f00000000;
+static constexpr uint64_t crc32c_fold_1536_lo= 0x7ccbbbf200000000;
+static constexpr uint64_t crc32c_fold_1536_hi= 0x31c9460800000000;
+static constexpr uint64_t crc32c_fold_2048_lo= 0xe9a5d8be00000000;
+static constexpr uint64_t crc32c_fold_2048_hi= 0x1426a81500000000;
+
+USE_VPCLMULQDQ
+static inline __m512i crc32c_fold(__m512i x, __m512i k, __m512i data)
+{
+  return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(x, k, 0x00),
+                                   _mm512_clmulepi64_epi128(x, k, 0x11),
+                                   data, 0x96);
+}
+
+USE_VPCLMULQDQ
+static inline __m128i crc32c_fold(__m128i x, uint64_t lo, uint64_t hi,
+                                  __m128i data)
+{
+  const __m128i k= _mm_set_epi64x(static_cast<long long>(hi),
+                                  static_cast<long long>(lo));
+  return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                                     _mm_clmulepi64_si128(x, k, 0x11)),
+                       data);
+}
+
+USE_VPCLMULQDQ
+static inline __m512i crc32c_fold_constant(uint64_t lo, uint64_t hi)
+{
+  return _mm512_broadcast_i32x4(_mm_set_epi64x(static_cast<long long>(hi),
+                                               static_cast<long long>(lo)));
+}
+
+/* Fold 4 independent 512-bit accumulators over the input, 256 bytes
+per iteration, and reduce the 512-bit remainder to 128 bits. That is
+reduced to 32 bits by the crc32 instruction, which also processes the
+remaining bytes. */
+USE_VPCLMULQDQ
+static uint32_t crc32c_vpclmulqdq(uint32_t crc, const char *buf, size_t size)
+{
+  if (size < 256)
+    return crc32c_3way(crc, buf, size);
+
+  const __m512i k2048= crc32c_fold_constant(crc32c_fold_2048_lo,
+                                            crc32c_fold_2048_hi);
+  __m512i x0= _mm512_xor_si512(_mm512_loadu_si512(buf),
+                               _mm512_maskz_set1_epi32(1, int(~crc)));
+  __m512i x1= _mm512_loadu_si512(buf + 64);
+  __m512i x2= _mm512_loadu_si512(buf + 128);
+  __m512i x3= _mm512_loadu_si512(buf + 192);
+
+  for (buf+= 256, size-= 256; size >= 256; buf+= 256, size-= 256)
+  {
+    x0= crc32c_fold(x0, k2048, _mm512_loadu_si512(buf));
+    x1= crc32c_fold(x1, k2048, _mm512_loadu_si512(buf + 64));
+    x2= crc32c_fold(x2, k2048, _mm512_loadu_si512(buf + 128));
+    x3= crc32c_fold(x3, k2048, _mm512_loadu_si512(buf + 192));
+  }
+
+  x3= crc32c_fold(x2, crc32c_fold_constant(crc32c_fold_512_lo,
+                                           crc32c_fold_512_hi), x3);
+  x3= crc32c_fold(x1, crc32c_fold_constant(crc32c_fold_1024_lo,
+                                           crc32c_fold_1024_hi), x3);
+  x3= crc32c_fold(x0, crc32c_fold_constant(crc32c_fold_1536_lo,
+                                           crc32c_fold_1536_hi), x3);
+
+  __m128i r= _mm512_extracti32x4_epi32(x3, 3);
+  r= crc32c_fold(_mm512_extracti32x4_epi32(x3, 2),
+                 crc32c_fold_128_lo, crc32c_fold_128_hi, r);
+  r= crc32c_fold(_mm512_extracti32x4_epi32(x3, 1),
+                 crc32c_fold_256_lo, crc32c_fold_256_hi, r);
+  r= crc32c_fold(_mm512_castsi512_si128(x3),
+                 crc32c_fold_384_lo, crc32c_fold_384_hi, r);
+
+  uint64_t l= _mm_crc32_u64(0, static_cast<uint64_t>(_mm_cvtsi128_si64(r)));
+  l= _mm_crc32_u64(l, static_cast<uint64_t>(_mm_extract_epi64(r, 1)));
+  return crc32c_3way(static_cast<uint32_t>(~l), buf, size);
+}
+# endif
 #endif
 
 typedef uint32_t (*Function)(uint32_t, const char*, size_t);
@@ -550,6 +673,10 @@ static inline Function Choose_Extend()
     return ExtendARMImpl;
 #elif HAVE_SSE42
 # if defined HAVE_PCLMUL && SIZEOF_SIZE_T == 8
+#  ifdef HAVE_VPCLMULQDQ
+  if (have_vpclmulqdq())
+    return crc32c_vpclmulqdq;
+#  endif
   switch (cpuid_ecx() & cpuid_ecx_SSE42_AND_PCLMUL) {
   case cpuid_ecx_SSE42_AND_PCLMUL:
     return crc32c_3way;
@@ -571,6 +698,71 @@ static inline uint32_t Extend(uint32_t crc, const char* buf, size_t size)
   return ChosenExtend(crc, buf, size);
 }
 
+typedef void (*MultiFunction)(uint32_t *crc, const char *buf, size_t size,
+                              size_t stride, size_t n);
+
+static void crc32c_multi_generic(uint32_t *crc, const char *buf, size_t size,
+                                 size_t stride, size_t n)
+{
+  for (; n--; crc++, buf+= stride)
+    *crc= Extend(*crc, buf, size);
+}
+
+#if defined HAVE_SSE42 && SIZEOF_SIZE_T == 8 && \
+  !defined HAVE_POWER8 && !defined HAVE_ARMV8_CRC
+/* The crc32 instruction has a latency of 3 cycles but a throughput of
+1 instruction per cycle. By interleaving the computation of 4 independent
+buffers, we keep the execution unit busy without having to combine
+partial results, like crc32c_3way() does for a single buffer. */
+# define CRC32C_MULTI 4
+
+USE_SSE42
+static void crc32c_sse42_multi(uint32_t *crc, const char *buf, size_t size,
+                               size_t stride, size_t n)
+{
+  for (; n >= CRC32C_MULTI; n-= CRC32C_MULTI, crc+= CRC32C_MULTI,
+         buf+= CRC32C_MULTI * stride)
+  {
+    const uint8_t *p0= reinterpret_cast<const uint8_t*>(buf);
+    const uint8_t *p1= p0 + stride, *p2= p1 + stride, *p3= p2 + stride;
+    uint64_t l0= crc[0] ^ 0xffffffffu, l1= crc[1] ^ 0xffffffffu;
+    uint64_t l2= crc[2] ^ 0xffffffffu, l3= crc[3] ^ 0xffffffffu;
+    size_t i= 0;
+    for (; i + 8 <= size; i+= 8)
+    {
+      l0= _mm_crc32_u64(l0, LE_LOAD64(p0 + i));
+      l1= _mm_crc32_u64(l1, LE_LOAD64(p1 + i));
+      l2= _mm_crc32_u64(l2, LE_LOAD64(p2 + i));
+      l3= _mm_crc32_u64(l3, LE_LOAD64(p3 + i));
+    }
+    for (; i < size; i++)
+    {
+      l0= _mm_crc32_u8(static_cast<uint32_t>(l0), p0[i]);
+      l1= _mm_crc32_u8(static_cast<uint32_t>(l1), p1[i]);
+      l2= _mm_crc32_u8(static_cast<uint32_t>(l2), p2[i]);
+      l3= _mm_crc32_u8(static_cast<uint32_t>(l3), p3[i]);
+    }
+    crc[0]= static_cast<uint32_t>(l0 ^ 0xffffffffu);
+    crc[1]= static_cast<uint32_t>(l1 ^ 0xffffffffu);
+    crc[2]= static_cast<uint32_t>(l2 ^ 0xffffffffu);
+    crc[3]= static_cast<uint32_t>(l3 ^ 0xffffffffu);
+  }
+  crc32c_multi_generic(crc, buf, size, stride, n);
+}
+#endif
+
+static inline MultiFunction Choose_Multi()
+{
+#ifdef CRC32C_MULTI
+  /* crc32c_3way() is about as fast as interleaving multiple buffers */
+  if (ChosenExtend == crc32c_sse42)
+    return crc32c_sse42_multi;
+#endif
+  return crc32c_multi_generic;
+}
+
+static const MultiFunction ChosenMulti= Choose_Multi();
+
 extern "C" const char *my_crc32c_implementation()
 {
 #if defined(HAVE_POWER8) && defined(HAS_ALTIVEC)
@@ -580,6 +772,10 @@ extern "C" const char *my_crc32c_implementation()
   if (const char *ret= crc32c_aarch64_available())
     return ret;
 #elif HAVE_SSE42
+# ifdef HAVE_VPCLMULQDQ
+  if (ChosenExtend == crc32c_vpclmulqdq)
+    return "Using AVX512 + vpclmulqdq instructions";
+# endif
 # if defined HAVE_PCLMUL && SIZEOF_SIZE_T == 8
   if (ChosenExtend == crc32c_3way)
     return "Using crc32 + pclmulqdq instructions";
@@ -596,3 +792,10 @@ extern "C" unsigned my_crc32c(unsigned int crc, const char *buf, size_t size)
 {
   return mysys_namespace::crc32c::Extend(crc,buf, size);
 }
+
+extern "C" void my_crc32c_multi(uint32 *crc, const void *buf, size_t size,
+                                size_t stride, size_t n)
+{
+  mysys_namespace::crc32c::ChosenMulti(crc, static_cast<const char*>(buf),
+                                       size, stride, n);
+}
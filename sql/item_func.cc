@@ -6192,13 +6192,19 @@ bool Item_func_match::init_search(THD *thd, bool no_order)
     ft_tmp= &search_value;
   }
 
+  ha_rows limit= HA_POS_ERROR;
   if (join_key && !no_order)
+  {
     match_flags|=FT_SORTED;
+    limit= sorted_read_limit();
+  }
 
   if (key != NO_SUCH_KEY)
     THD_STAGE_INFO(table->in_use, stage_fulltext_initialization);
 
-  ft_handler= table->file->ft_init_ext(match_flags, key, ft_tmp);
+  ft_handler= limit == HA_POS_ERROR
+    ? table->file->ft_init_ext(match_flags, key, ft_tmp)
+    : table->file->ft_init_ext_with_limit(match_flags, key, ft_tmp, limit);
 
   if (join_key)
     table->file->ft_handler=ft_handler;
@@ -6207,6 +6213,41 @@ bool Item_func_match::init_search(THD *thd, bool no_order)
 }
 
 
+/**
+  Get the number of rows that will be read from a FT_SORTED search.
+
+  Every row that the search returns in relevance order is sent to the
+  client only if this MATCH is the whole WHERE condition of a single-table
+  SELECT without grouping, aggregation, DISTINCT, HAVING, window functions,
+  WITH TIES or SQL_CALC_FOUND_ROWS. Then LIMIT (plus OFFSET) bounds the
+  number of rows read.
+
+  @return the number of rows, or HA_POS_ERROR if it is not bounded
+*/
+
+ha_rows Item_func_match::sorted_read_limit() const
+{
+  const TABLE_LIST *tl= table->pos_in_table_list;
+  JOIN *join= tl && tl->select_lex ? tl->select_lex->join : NULL;
+
+  if (!join || join->table_count != 1 || !join->conds ||
+      join->unit->is_unit_op() || join->group_list || join->having ||
+      join->select_distinct || join->tmp_table_param.sum_func_count ||
+      (join->select_options & OPTION_FOUND_ROWS) ||
+      join->select_lex->have_window_funcs() ||
+      join->unit->lim.is_with_ties())
+    return HA_POS_ERROR;
+
+  if (join->conds != this &&
+      (join->conds->type() != FUNC_ITEM ||
+       ((Item_func*) join->conds)->functype() != FT_FUNC ||
+       ((Item_func_match*) join->conds)->master != this))
+    return HA_POS_ERROR;
+
+  return join->row_limit;
+}
+
+
 bool Item_func_match::fix_fields(THD *thd, Item **ref)
 {
   DBUG_ASSERT(fixed() == 0);
@@ -3641,6 +3641,7 @@ class Item_func_match :public Item_real_func
 
   bool fix_index();
   bool init_search(THD *thd, bool no_order);
+  ha_rows sorted_read_limit() const;
   bool check_vcol_func_processor(void *arg) override
   {
     return mark_unsupported_function("match ... against()", arg, VCOL_IMPOSSIBLE);
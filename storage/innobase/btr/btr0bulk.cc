@@ -962,7 +962,30 @@ BtrBulk::pageCommit(
 	}
 
 	/* Insert node pointer to father page. */
-	if (insert_father) {
+	if (insert_father && m_node_ptr_heap) {
+		/* In a leaf-only load, the node pointer will be
+		inserted by stitch(). Copy it, because the page_bulk
+		heap will be freed. */
+		ut_ad(page_bulk->getLevel() == 0);
+		const dtuple_t*	node_ptr = page_bulk->getNodePtr();
+		dtuple_t*	copy = dtuple_copy(node_ptr, m_node_ptr_heap);
+
+		for (ulint i = 0; i < dtuple_get_n_fields(copy); i++) {
+			dfield_dup(dtuple_get_nth_field(copy, i),
+				   m_node_ptr_heap);
+		}
+
+		dtuple_set_info_bits(copy, dtuple_get_info_bits(node_ptr));
+		dtuple_set_n_fields_cmp(copy,
+					dtuple_get_n_fields_cmp(node_ptr));
+		m_node_ptrs.push_back(copy);
+
+		if (m_first_leaf == FIL_NULL) {
+			m_first_leaf = page_bulk->getPageNo();
+		}
+
+		m_last_leaf = page_bulk->getPageNo();
+	} else if (insert_father) {
 		dtuple_t*	node_ptr = page_bulk->getNodePtr();
 		dberr_t		err = insert(node_ptr, page_bulk->getLevel()+1);
 
@@ -996,9 +1019,9 @@ BtrBulk::release()
 	ut_ad(m_root_level + 1 == m_page_bulks.size());
 
 	for (ulint level = 0; level <= m_root_level; level++) {
-		PageBulk*    page_bulk = m_page_bulks.at(level);
-
-		page_bulk->release();
+		if (PageBulk* page_bulk = m_page_bulks.at(level)) {
+			page_bulk->release();
+		}
 	}
 }
 
@@ -1009,8 +1032,9 @@ BtrBulk::latch()
 	ut_ad(m_root_level + 1 == m_page_bulks.size());
 
 	for (ulint level = 0; level <= m_root_level; level++) {
-		PageBulk*    page_bulk = m_page_bulks.at(level);
-		page_bulk->latch();
+		if (PageBulk* page_bulk = m_page_bulks.at(level)) {
+			page_bulk->latch();
+		}
 	}
 }
 
@@ -1154,6 +1178,84 @@ BtrBulk::insert(
 	return(err);
 }
 
+/** Link the leaf pages that were loaded by leaf-only BtrBulk
+objects, and build the non-leaf levels of the tree from their
+node pointers. The caller must invoke finish() afterwards.
+@param[in]	parts	finished leaf-only loads, in key order
+@param[in]	n	number of elements in parts
+@return error code */
+dberr_t
+BtrBulk::stitch(BtrBulk* const* parts, ulint n)
+{
+	const BtrBulk*	prev = NULL;
+	ulint		n_node_ptrs = 0;
+
+	ut_ad(!m_node_ptr_heap);
+	ut_ad(m_page_bulks.empty());
+
+	for (ulint i = 0; i < n; i++) {
+		const BtrBulk*	part = parts[i];
+
+		ut_ad(part->m_node_ptr_heap);
+		ut_ad(part->m_page_bulks.empty());
+
+		if (part->m_first_leaf == FIL_NULL) {
+			continue;
+		}
+
+		if (prev != NULL) {
+			mtr_t	mtr;
+
+			mtr.start();
+			m_index->set_modified(mtr);
+
+			buf_block_t*	left = btr_block_get(
+				*m_index, prev->m_last_leaf, RW_X_LATCH,
+				false, &mtr);
+			buf_block_t*	right = btr_block_get(
+				*m_index, part->m_first_leaf, RW_X_LATCH,
+				false, &mtr);
+
+			ut_ad(!page_has_next(left->frame));
+			ut_ad(!page_has_prev(right->frame));
+
+			btr_page_set_next(left, part->m_first_leaf, &mtr);
+			btr_page_set_prev(right, prev->m_last_leaf, &mtr);
+
+			mtr.commit();
+		}
+
+		prev = part;
+		n_node_ptrs += part->m_node_ptrs.size();
+	}
+
+	if (n_node_ptrs == 0) {
+		return(DB_SUCCESS);
+	}
+
+	/* The leaf level is not owned by this object. */
+	m_page_bulks.push_back(NULL);
+	m_root_level = 0;
+
+	for (ulint i = 0; i < n; i++) {
+		for (dtuple_t* node_ptr : parts[i]->m_node_ptrs) {
+			dberr_t	err = insert(node_ptr, 1);
+
+			if (err != DB_SUCCESS) {
+				return(err);
+			}
+		}
+
+		if (trx_is_interrupted(m_trx)) {
+			return(DB_INTERRUPTED);
+		}
+
+		logFreeCheck();
+	}
+
+	return(DB_SUCCESS);
+}
+
 /** Btree bulk load finish. We commit the last page in each level
 and copy the last page in top level to the root page of the index
 if no error occurs.
@@ -1174,10 +1276,35 @@ BtrBulk::finish(dberr_t	err)
 
 	ut_ad(m_root_level + 1 == m_page_bulks.size());
 
+	if (m_node_ptr_heap) {
+		/* Commit the last leaf page of a leaf-only load.
+		The upper levels will be built by stitch(). */
+		ut_ad(m_root_level == 0);
+		PageBulk*	page_bulk = m_page_bulks.at(0);
+
+		if (err == DB_SUCCESS) {
+			err = pageCommit(page_bulk, NULL, true);
+		}
+
+		if (err != DB_SUCCESS) {
+			pageAbort(page_bulk);
+		}
+
+		UT_DELETE(page_bulk);
+		m_page_bulks.clear();
+		return(err);
+	}
+
 	/* Finish all page bulks */
 	for (ulint level = 0; level <= m_root_level; level++) {
 		PageBulk*	page_bulk = m_page_bulks.at(level);
 
+		if (page_bulk == NULL) {
+			/* The leaf level was loaded by stitch() parts */
+			ut_ad(level == 0);
+			continue;
+		}
+
 		last_page_no = page_bulk->getPageNo();
 
 		if (err == DB_SUCCESS) {
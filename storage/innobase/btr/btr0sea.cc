@@ -55,6 +55,10 @@ ulint		btr_search_n_succ	= 0;
 ulint		btr_search_n_hash_fail	= 0;
 #endif /* UNIV_SEARCH_PERF_STAT */
 
+/** Number of adaptive hash index lookups that found a record but
+fell back to a B-tree search because the page latch was not available */
+ib_counter_t<ulint, ib_counter_element_t>	btr_search_n_latch_fail;
+
 #ifdef UNIV_PFS_RWLOCK
 mysql_pfs_key_t	btr_search_latch_key;
 #endif /* UNIV_PFS_RWLOCK */
@@ -1105,12 +1109,12 @@ btr_search_guess_on_hash(
 		hash_lock->read_unlock();
 		block->page.set_accessed();
 
-		buf_page_make_young_if_needed(&block->page);
 		mtr_memo_type_t	fix_type;
 		if (latch_mode == BTR_SEARCH_LEAF) {
 			if (!block->lock.s_lock_try()) {
 got_no_latch:
 				buf_block_buf_fix_dec(block);
+				++btr_search_n_latch_fail;
 				goto fail;
 			}
 			fix_type = MTR_MEMO_PAGE_S_FIX;
@@ -1122,10 +1126,16 @@ btr_search_guess_on_hash(
 		}
 		mtr->memo_push(block, fix_type);
 
-		++buf_pool.stat.n_page_gets;
-
+		/* The page latch protects rec from now on. Release the
+		adaptive hash index latch before
+		buf_page_make_young_if_needed() may acquire
+		buf_pool.mutex. */
 		part->latch.rd_unlock();
 
+		buf_page_make_young_if_needed(&block->page);
+
+		++buf_pool.stat.n_page_gets;
+
 		if (UNIV_UNLIKELY(fail)) {
 			goto fail_and_release_page;
 		}
@@ -453,7 +453,7 @@ byte *buf_buddy_alloc_low(ulint i, bool *lru)
 	}
 
 	/* Try replacing an uncompressed page in the buffer pool. */
-	block = buf_LRU_get_free_block(true);
+	block = buf_LRU_get_free_block(true, -1);
 	if (lru) {
 		*lru = true;
 	}
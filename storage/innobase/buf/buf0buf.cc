@@ -109,6 +109,27 @@ struct set_numa_interleave_t
 };
 
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE set_numa_interleave_t scoped_numa
+
+/** Choose the NUMA node for the next buffer pool chunk
+when innodb_numa_local is set.
+@return NUMA node, in a round-robin fashion among the allowed nodes */
+static unsigned buf_numa_next_node()
+{
+	static unsigned next;
+	struct bitmask* numa_mems_allowed = numa_get_mems_allowed();
+	const unsigned n = unsigned(numa_max_node()) + 1;
+	unsigned node = next % n;
+
+	for (unsigned i = n; i--; node = (node + 1) % n) {
+		if (numa_bitmask_isbitset(numa_mems_allowed, node)) {
+			break;
+		}
+	}
+
+	numa_bitmask_free(numa_mems_allowed);
+	next = node + 1;
+	return node;
+}
 #else
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE
 #endif /* HAVE_LIBNUMA */
@@ -580,12 +601,15 @@ bool buf_is_zeroes(span<const byte> buf)
 @param[in]	read_buf	database page
 @param[in]	zip_size	ROW_FORMAT=COMPRESSED page size, or 0
 @param[in]	space		tablespace
+@param[in]	page_crc32	checksum computed by buf_calc_pages_full_crc32(),
+				or nullptr
 @return whether the page is corrupted */
 bool
 buf_page_is_corrupted(
 	bool			check_lsn,
 	const byte*		read_buf,
-	ulint			fsp_flags)
+	ulint			fsp_flags,
+	const uint32_t*		page_crc32)
 {
 #ifndef UNIV_INNOCHECKSUM
 	DBUG_EXECUTE_IF("buf_page_import_corrupt_failure", return(true); );
@@ -613,8 +637,10 @@ buf_page_is_corrupted(
 			}
 		});
 
-		if (crc32 != ut_crc32(read_buf,
-				      size - FIL_PAGE_FCRC32_CHECKSUM)) {
+		if (crc32 != (page_crc32 && size == srv_page_size
+			      ? *page_crc32
+			      : ut_crc32(read_buf,
+					 size - FIL_PAGE_FCRC32_CHECKSUM))) {
 			return true;
 		}
 		static_assert(FIL_PAGE_FCRC32_KEY_VERSION == 0, "alignment");
@@ -1007,6 +1033,7 @@ inline bool buf_pool_t::chunk_t::create(size_t bytes)
   MEM_UNDEFINED(mem, mem_size());
 
 #ifdef HAVE_LIBNUMA
+  numa_node= 0;
   if (srv_numa_interleave)
   {
     struct bitmask *numa_mems_allowed= numa_get_mems_allowed();
@@ -1020,9 +1047,22 @@ inline bool buf_pool_t::chunk_t::create(size_t bytes)
     }
     numa_bitmask_free(numa_mems_allowed);
   }
+  else if (srv_numa_local)
+  {
+    numa_node= buf_numa_next_node();
+    struct bitmask *mask= numa_allocate_nodemask();
+    numa_bitmask_setbit(mask, numa_node);
+    if (mbind(mem, mem_size(), MPOL_PREFERRED,
+              mask->maskp, mask->size, MPOL_MF_MOVE))
+    {
+      ib::warn() << "Failed to set NUMA memory policy of"
+              " buffer pool page frames to MPOL_PREFERRED"
+              " (error: " << strerror(errno) << ").";
+    }
+    numa_bitmask_free(mask);
+  }
 #endif /* HAVE_LIBNUMA */
 
-
   /* Allocate the block descriptors from
   the start of the memory block. */
   blocks= reinterpret_cast<buf_block_t*>(mem);
@@ -1060,6 +1100,9 @@ inline bool buf_pool_t::chunk_t::create(size_t bytes)
 
   for (auto i= size; i--; ) {
     buf_block_init(block, frame);
+#ifdef HAVE_LIBNUMA
+    block->numa_node= uint8_t(numa_node);
+#endif
     MEM_UNDEFINED(block->frame, srv_page_size);
     /* Add the block to the free list */
     UT_LIST_ADD_LAST(buf_pool.free, &block->page);
@@ -2744,10 +2787,11 @@ buf_page_get_low(
 		or relocated while we are attempting to allocate an
 		uncompressed page. */
 
-		block = buf_LRU_get_free_block(false);
+		const int numa_node = buf_LRU_numa_node();
+		mysql_mutex_lock(&buf_pool.mutex);
+		block = buf_LRU_get_free_block(true, numa_node);
 		buf_block_init_low(block);
 
-		mysql_mutex_lock(&buf_pool.mutex);
 		hash_lock = buf_pool.page_hash.lock_get(fold);
 
 		hash_lock->write_lock();
@@ -4193,6 +4237,10 @@ void buf_stats_get_pool_info(buf_pool_info_t *pool_info)
 
 	pool_info->unzip_cur = buf_LRU_stat_cur.unzip;
 
+	pool_info->numa_local = buf_pool.stat.n_numa_local;
+
+	pool_info->numa_remote = buf_pool.stat.n_numa_remote;
+
 	buf_refresh_io_stats();
 	mysql_mutex_unlock(&buf_pool.mutex);
 }
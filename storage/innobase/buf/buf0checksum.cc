@@ -54,6 +54,19 @@ uint32_t buf_calc_page_crc32(const byte* page)
 			   - (FIL_PAGE_DATA + FIL_PAGE_END_LSN_OLD_CHKSUM));
 }
 
+/** Calculate the innodb_checksum_algorithm=full_crc32 checksums of
+adjacent uncompressed pages, interleaving the computation where possible.
+@param[in]	pages	n pages of srv_page_size bytes each
+@param[in]	n	number of pages
+@param[out]	crc32	the checksum of each page */
+void buf_calc_pages_full_crc32(const byte* pages, size_t n, uint32_t* crc32)
+{
+	memset(crc32, 0, n * sizeof *crc32);
+	my_crc32c_multi(crc32, pages,
+			srv_page_size - FIL_PAGE_FCRC32_CHECKSUM,
+			srv_page_size, n);
+}
+
 #ifndef UNIV_INNOCHECKSUM
 /** Calculate a checksum which is stored to the page when it is written
 to a file. Note that we must be careful to calculate the same value on
@@ -52,13 +52,16 @@ inline void buf_dblwr_t::init(const byte *header)
 {
   ut_ad(!active_slot->first_free);
   ut_ad(!active_slot->reserved);
-  ut_ad(!batch_running);
+  ut_ad(!writing);
 
   mysql_mutex_init(buf_dblwr_mutex_key, &mutex, nullptr);
   pthread_cond_init(&cond, nullptr);
   block1= page_id_t(0, mach_read_from_4(header + TRX_SYS_DOUBLEWRITE_BLOCK1));
   block2= page_id_t(0, mach_read_from_4(header + TRX_SYS_DOUBLEWRITE_BLOCK2));
 
+  /* A batch may fill both doublewrite blocks. While the data pages of
+  a batch that occupies only one block are being written, the next batch
+  can be written to the other block. */
   const uint32_t buf_size= 2 * block_size();
   for (int i= 0; i < 2; i++)
   {
@@ -443,7 +446,10 @@ void buf_dblwr_t::close()
   /* Free the double write data structures. */
   ut_ad(!active_slot->reserved);
   ut_ad(!active_slot->first_free);
-  ut_ad(!batch_running);
+  ut_ad(!slots[0].running);
+  ut_ad(!slots[1].running);
+  ut_ad(!writing);
+  ut_ad(!flushing_buffered_writes);
 
   pthread_cond_destroy(&cond);
   for (int i= 0; i < 2; i++)
@@ -457,8 +463,9 @@ void buf_dblwr_t::close()
   active_slot= &slots[0];
 }
 
-/** Update the doublewrite buffer on write completion. */
-void buf_dblwr_t::write_completed()
+/** Update the doublewrite buffer on write completion.
+@param bpage  the page whose write was completed */
+void buf_dblwr_t::write_completed(const buf_page_t &bpage)
 {
   ut_ad(this == &buf_dblwr);
   ut_ad(srv_use_doublewrite_buf);
@@ -467,8 +474,24 @@ void buf_dblwr_t::write_completed()
 
   mysql_mutex_lock(&mutex);
 
-  ut_ad(batch_running);
   slot *flush_slot= active_slot == &slots[0] ? &slots[1] : &slots[0];
+  if (!flush_slot->running)
+    flush_slot= active_slot;
+  else if (active_slot->running)
+  {
+    /* Both batches are being written. The batch of active_slot was
+    started first. A block descriptor that occurs in the newer batch
+    cannot belong to a pending write of the older batch, because the
+    page remains io-fixed until its write completes. */
+    const element *e= flush_slot->buf_block_arr;
+    const element *const end= e + flush_slot->first_free;
+    while (e != end && e->request.bpage != &bpage)
+      e++;
+    if (e == end)
+      flush_slot= active_slot;
+  }
+
+  ut_ad(flush_slot->running);
   ut_ad(flush_slot->reserved);
   ut_ad(flush_slot->reserved <= flush_slot->first_free);
 
@@ -481,7 +504,7 @@ void buf_dblwr_t::write_completed()
 
     /* We can now reuse the doublewrite memory buffer: */
     flush_slot->first_free= 0;
-    batch_running= false;
+    flush_slot->running= false;
     pthread_cond_broadcast(&cond);
   }
 
@@ -555,27 +578,44 @@ bool buf_dblwr_t::flush_buffered_writes(const ulint size)
 
   for (;;)
   {
-    if (!active_slot->first_free)
+    /* If the active slot is still being written, all writes that
+    were buffered in it have already been submitted. */
+    if (active_slot->running || !active_slot->first_free)
       return false;
-    if (!batch_running)
-      break;
+    /* Only one batch may be written to the doublewrite buffer at a time.
+    The data page writes of the other slot may still be in progress,
+    and its copies in the doublewrite buffer must be preserved until
+    they complete. Unless the other batch occupies both blocks, the
+    remaining block can be written to if this batch fits in it. */
+    if (!writing)
+    {
+      const slot &other= slots[active_slot == &slots[0]];
+      if (!other.running ||
+          (other.blocks != 3 && active_slot->first_free <= size))
+        break;
+    }
     my_cond_wait(&cond, &mutex.m_mutex);
   }
 
   ut_ad(active_slot->reserved == active_slot->first_free);
+  ut_ad(active_slot->first_free <= 2 * size);
   ut_ad(!flushing_buffered_writes);
 
   /* Disallow anyone else to start another batch of flushing. */
   slot *flush_slot= active_slot;
-  /* Switch the active slot */
-  active_slot= active_slot == &slots[0] ? &slots[1] : &slots[0];
-  ut_a(active_slot->first_free == 0);
-  batch_running= true;
+  const slot &other= slots[flush_slot == &slots[0]];
   const ulint old_first_free= flush_slot->first_free;
-  auto write_buf= flush_slot->write_buf;
-  const bool multi_batch= block1 + static_cast<uint32_t>(size) != block2 &&
-    old_first_free > size;
+  flush_slot->blocks= old_first_free > size
+    ? 3 : other.running ? 3 & ~other.blocks : 1;
+  const bool multi_batch= flush_slot->blocks == 3 &&
+    block1 + static_cast<uint32_t>(size) != block2;
   flushing_buffered_writes= 1 + multi_batch;
+  /* Switch the active slot. If its previous batch is still running,
+  add_to_batch() will wait for it to complete. */
+  active_slot= active_slot == &slots[0] ? &slots[1] : &slots[0];
+  flush_slot->running= true;
+  writing= flush_slot;
+  auto write_buf= flush_slot->write_buf;
   pages_submitted+= old_first_free;
   /* Now safe to release the mutex. */
   mysql_mutex_unlock(&mutex);
@@ -609,7 +649,8 @@ bool buf_dblwr_t::flush_buffered_writes(const ulint size)
   }
   else
     os_aio(request, write_buf,
-           os_offset_t{block1.page_no()} << srv_page_size_shift,
+           os_offset_t{(flush_slot->blocks == 2 ? block2 : block1).page_no()}
+           << srv_page_size_shift,
            old_first_free << srv_page_size_shift);
   return true;
 }
@@ -624,7 +665,10 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
   ut_ad(request.node == fil_system.sys_space->chain.start);
   ut_ad(request.type == IORequest::DBLWR_BATCH);
   mysql_mutex_lock(&mutex);
-  ut_ad(batch_running);
+  slot *const flush_slot= writing;
+  ut_ad(flush_slot);
+  ut_ad(flush_slot->running);
+  ut_ad(flush_slot->reserved == flush_slot->first_free);
   ut_ad(flushing_buffered_writes);
   ut_ad(flushing_buffered_writes <= 2);
   writes_completed++;
@@ -634,8 +678,6 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
     return;
   }
 
-  slot *const flush_slot= active_slot == &slots[0] ? &slots[1] : &slots[0];
-  ut_ad(flush_slot->reserved == flush_slot->first_free);
   /* increment the doublewrite flushed pages counter */
   pages_written+= flush_slot->first_free;
   mysql_mutex_unlock(&mutex);
@@ -643,9 +685,16 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
   /* Now flush the doublewrite buffer data to disk */
   fil_system.sys_space->flush<false>();
 
+  /* Allow the other slot to be written to its doublewrite block
+  while the data pages of this batch are being written. */
+  mysql_mutex_lock(&mutex);
+  writing= nullptr;
+  pthread_cond_broadcast(&cond);
+  mysql_mutex_unlock(&mutex);
+
   /* The writes have been flushed to disk now and in recovery we will
   find them in the doublewrite buffer blocks. Next, write the data pages. */
-  for (ulint i= 0, first_free= flush_slot->first_free; i < first_free; i++)
+  for (ulint i= 0, first_free= flush_slot->first_free; i < first_free; )
   {
     auto e= flush_slot->buf_block_arr[i];
     buf_page_t* bpage= e.request.bpage;
@@ -669,15 +718,57 @@ void buf_dblwr_t::flush_buffered_writes_completed(const IORequest &request)
       ut_d(buf_dblwr_check_page_lsn(*bpage, static_cast<const byte*>(frame)));
     }
 
-    const lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
-                                      (FIL_PAGE_LSN +
-                                       static_cast<const byte*>(frame)));
+    lsn_t lsn= mach_read_from_8(my_assume_aligned<8>
+                                (FIL_PAGE_LSN +
+                                 static_cast<const byte*>(frame)));
     ut_ad(lsn);
     ut_ad(lsn >= bpage->oldest_modification());
+
+    /* Merge the writes of adjacent full-size pages of the same file
+    that were added to the batch one after another. Their copies are
+    adjacent in write_buf. */
+    uint32_t n= 1;
+    if (e_size == srv_page_size && !(e.request.type & ~IORequest::WRITE_LRU) &&
+        !UT_LIST_GET_NEXT(chain, e.request.node))
+    {
+      for (const page_id_t id{bpage->id()}; i + n < first_free; n++)
+      {
+        const element &next= flush_slot->buf_block_arr[i + n];
+        if (next.request.node != e.request.node ||
+            next.request.type != e.request.type ||
+            next.size != srv_page_size ||
+            next.request.bpage->zip.data ||
+            next.request.bpage->id() != id + n)
+          break;
+        const byte *next_frame= static_cast<const byte*>
+          (buf_page_get_frame(next.request.bpage));
+        const lsn_t next_lsn= mach_read_from_8(my_assume_aligned<8>
+                                               (FIL_PAGE_LSN + next_frame));
+        ut_ad(next_lsn >= next.request.bpage->oldest_modification());
+        if (next_lsn > lsn)
+          lsn= next_lsn;
+      }
+    }
+
     if (lsn > log_sys.get_flushed_lsn())
       log_write_up_to(lsn, true);
-    e.request.node->space->io(e.request, bpage->physical_offset(), e_size,
-                              frame, bpage);
+
+    if (n == 1)
+      e.request.node->space->io(e.request, bpage->physical_offset(), e_size,
+                                frame, bpage);
+    else
+    {
+      fil_space_t *space= e.request.node->space;
+      /* Each page holds a reference to the tablespace,
+      but there will be only one write completion. */
+      for (uint32_t j= 1; j < n; j++)
+        space->release();
+      space->io(IORequest(bpage, e.request.node, e.request.type, n),
+                bpage->physical_offset(), size_t{n} << srv_page_size_shift,
+                flush_slot->write_buf + (i << srv_page_size_shift), bpage);
+    }
+
+    i+= n;
   }
 }
 
@@ -717,17 +808,25 @@ void buf_dblwr_t::add_to_batch(const IORequest &request, size_t size)
   ut_ad(request.node->space->referenced());
   ut_ad(!srv_read_only_mode);
 
-  const ulint buf_size= 2 * block_size();
-
   mysql_mutex_lock(&mutex);
 
+  ulint buf_size;
+
   for (;;)
   {
+    if (active_slot->running)
+    {
+      /* Wait for the previous batch of this slot to complete. */
+      my_cond_wait(&cond, &mutex.m_mutex);
+      continue;
+    }
+    /* The limit can only grow while active_slot is being filled,
+    because only flush_buffered_writes() of active_slot starts a batch. */
+    buf_size= batch_size();
     ut_ad(active_slot->first_free <= buf_size);
     if (active_slot->first_free != buf_size)
       break;
-
-    if (flush_buffered_writes(buf_size / 2))
+    if (flush_buffered_writes(block_size()))
       mysql_mutex_lock(&mutex);
   }
 
@@ -754,6 +853,6 @@ void buf_dblwr_t::add_to_batch(const IORequest &request, size_t size)
   active_slot->reserved= active_slot->first_free;
 
   if (active_slot->first_free != buf_size ||
-      !flush_buffered_writes(buf_size / 2))
+      !flush_buffered_writes(block_size()))
     mysql_mutex_unlock(&mutex);
 }
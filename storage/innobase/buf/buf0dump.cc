@@ -61,6 +61,12 @@ static volatile bool	buf_load_should_start;
 
 static bool	buf_load_abort_flag;
 
+/** Number of pages that buf_load() reads in a batch, sorted by page id */
+#define BUF_LOAD_BATCH	256
+
+/** When the latest buffer pool dump was started */
+static time_t	buf_dump_last_time;
+
 /** Start the buffer pool dump/load task and instructs it to start a dump. */
 void buf_dump_start()
 {
@@ -75,6 +81,23 @@ void buf_load_start()
   buf_do_load_dump();
 }
 
+/** Start a buffer pool dump if innodb_buffer_pool_dump_interval seconds
+have passed since the previous dump was started. */
+void buf_dump_if_due()
+{
+  if (!srv_buf_pool_dump_interval ||
+      export_vars.innodb_buffer_pool_load_incomplete)
+    /* Do not replace the dump while it is being loaded. */
+    return;
+
+  const time_t now= time(nullptr);
+
+  if (!buf_dump_last_time)
+    buf_dump_last_time= now;
+  else if (difftime(now, buf_dump_last_time) >= srv_buf_pool_dump_interval)
+    buf_dump_start();
+}
+
 /*****************************************************************//**
 Sets the global variable that feeds MySQL's innodb_buffer_pool_dump_status
 to the specified string. The format and the following parameters are the
@@ -245,6 +268,8 @@ buf_dump(
 	FILE*	f;
 	int	ret;
 
+	buf_dump_last_time = time(NULL);
+
 	buf_dump_generate_path(full_filename, sizeof(full_filename));
 
 	snprintf(tmp_filename, sizeof(tmp_filename),
@@ -624,16 +649,16 @@ buf_load()
 		return;
 	}
 
-	if (!SHUTTING_DOWN()) {
-		std::sort(dump, dump + dump_n);
-	}
-
 	ulint		last_check_time = 0;
 	ulint		last_activity_cnt = 0;
 
-	/* Avoid calling the expensive fil_space_t::get() for each
-	page within the same tablespace. dump[] is sorted by (space, page),
-	so all pages from a given tablespace are consecutive. */
+	/* buf_dump() wrote the pages starting from the most recently used
+	one. Load them in that order, so that the hottest pages become
+	available first. Within each batch of BUF_LOAD_BATCH pages, sort
+	by (space, page) so that pages of the same tablespace are adjacent
+	and we avoid calling the expensive fil_space_t::get() for each. */
+	std::sort(dump, dump + std::min<ulint>(dump_n, BUF_LOAD_BATCH));
+
 	ulint		cur_space_id = dump[0].space();
 	fil_space_t*	space = fil_space_t::get(cur_space_id);
 	ulint		zip_size = space ? space->zip_size() : 0;
@@ -645,6 +670,22 @@ buf_load()
 
 	for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
 
+		if (i && !(i % BUF_LOAD_BATCH)) {
+			std::sort(dump + i,
+				  dump + std::min<ulint>(dump_n,
+							 i + BUF_LOAD_BATCH));
+
+			/* Do not let the asynchronous reads of the
+			previous batches pile up: submit the next batch
+			only after fewer than BUF_LOAD_BATCH reads are
+			pending. */
+			while (buf_pool.n_pend_reads >= BUF_LOAD_BATCH
+			       && !SHUTTING_DOWN() && !buf_load_abort_flag) {
+				std::this_thread::sleep_for(
+					std::chrono::milliseconds(1));
+			}
+		}
+
 		/* space_id for this iteration of the loop */
 		const ulint	this_space_id = dump[i].space();
 
@@ -684,7 +725,7 @@ buf_load()
 		}
 
 		space->reacquire();
-		buf_read_page_background(space, dump[i], zip_size, true);
+		buf_read_page_background(space, dump[i], zip_size, false);
 
 		if (buf_load_abort_flag) {
 			if (space) {
@@ -721,6 +762,12 @@ buf_load()
 
 	ut_free(dump);
 
+	if (i == dump_n) {
+		/* The pages were submitted as asynchronous reads.
+		Do not report completion before they have been read. */
+		os_aio_wait_until_no_pending_reads();
+	}
+
 	ut_sprintf_timestamp(now);
 
 	if (i == dump_n) {
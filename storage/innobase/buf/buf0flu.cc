@@ -56,6 +56,11 @@ ulint buf_lru_freed_page_count;
 /** Number of pages flushed. Protected by buf_pool.mutex. */
 ulint buf_flush_page_count;
 
+/** Number of buf_flush_list() pages whose writes were initiated by
+buf_flush_batch_t worker tasks. Only updated by the thread that
+runs the buf_pool.flush_list batch. */
+ulint buf_flush_parallel_page_count;
+
 /** Flag indicating if the page_cleaner is in active state. */
 bool buf_page_cleaner_is_active;
 
@@ -341,13 +346,14 @@ buf_flush_relocate_on_flush_list(
 }
 
 /** Complete write of a file page from buf_pool.
+@param bpage   page that was written
 @param request write request */
-void buf_page_write_complete(const IORequest &request)
+static void buf_page_write_complete(buf_page_t *bpage,
+                                    const IORequest &request)
 {
   ut_ad(request.is_write());
   ut_ad(!srv_read_only_mode/* ||
         request.node->space->purpose == FIL_TYPE_TEMPORARY*/);
-  buf_page_t *bpage= request.bpage;
   ut_ad(bpage);
   ut_ad(bpage->in_file());
   /* bpage->io_fix() can only be changed by buf_page_write_complete()
@@ -364,7 +370,7 @@ void buf_page_write_complete(const IORequest &request)
     if (request.node->space->use_doublewrite())
     {
       ut_ad(request.node->space != fil_system.temp_space);
-      buf_dblwr.write_completed();
+      buf_dblwr.write_completed(*bpage);
     }
   }
 
@@ -414,6 +420,29 @@ void buf_page_write_complete(const IORequest &request)
   mysql_mutex_unlock(&buf_pool.mutex);
 }
 
+/** Complete write of file pages from buf_pool.
+@param request write request */
+void buf_page_write_complete(const IORequest &request)
+{
+  ut_ad(request.n_pages);
+  const page_id_t first{request.bpage->id()};
+  buf_page_write_complete(request.bpage, request);
+
+  /* The rest of the pages of a merged write are still io-fixed,
+  and thus they cannot be removed from buf_pool.page_hash. */
+  for (uint32_t i= 1; i < request.n_pages; i++)
+  {
+    const page_id_t id{first + i};
+    const ulint fold= id.fold();
+    page_hash_latch *hash_lock= buf_pool.page_hash.lock<false>(fold);
+    buf_page_t *bpage= buf_pool.page_hash_get_low(id, fold);
+    hash_lock->read_unlock();
+    ut_ad(bpage);
+    ut_ad(bpage->io_fix() == BUF_IO_WRITE);
+    buf_page_write_complete(bpage, request);
+  }
+}
+
 /** Calculate a ROW_FORMAT=COMPRESSED page checksum and update the page.
 @param[in,out]	page		page to update
 @param[in]	size		compressed page size */
@@ -792,13 +821,13 @@ inline void buf_pool_t::release_freed_page(buf_page_t *bpage)
   mysql_mutex_unlock(&mutex);
 }
 
-/** Write a flushable page from buf_pool to a file.
+/** Fix a flushable page for writing to a file.
 buf_pool.mutex must be held.
 @param bpage       buffer control block
 @param lru         true=buf_pool.LRU; false=buf_pool.flush_list
 @param space       tablespace
-@return whether the page was flushed and buf_pool.mutex was released */
-static bool buf_flush_page(buf_page_t *bpage, bool lru, fil_space_t *space)
+@return whether the page was fixed and buf_pool.mutex was released */
+static bool buf_flush_page_fix(buf_page_t *bpage, bool lru, fil_space_t *space)
 {
   ut_ad(bpage->in_file());
   ut_ad(bpage->ready_for_flush());
@@ -858,6 +887,23 @@ static bool buf_flush_page(buf_page_t *bpage, bool lru, fil_space_t *space)
   ut_ad(ULINT_UNDEFINED >
         (lru ? buf_pool.n_flush_LRU_ : buf_pool.n_flush_list_));
   mysql_mutex_unlock(&buf_pool.mutex);
+  return true;
+}
+
+/** Write a page that was fixed by buf_flush_page_fix() to a file.
+@param bpage       buffer control block
+@param lru         true=buf_pool.LRU; false=buf_pool.flush_list
+@param space       tablespace */
+static void buf_flush_page_write(buf_page_t *bpage, bool lru,
+                                 fil_space_t *space)
+{
+  mysql_mutex_assert_not_owner(&buf_pool.mutex);
+  ut_ad(bpage->io_fix() == BUF_IO_WRITE);
+  ut_ad(space->referenced());
+  const auto status= bpage->status;
+  ut_d(const lsn_t oldest_modification= bpage->oldest_modification());
+  block_lock *rw_lock= bpage->state() == BUF_BLOCK_FILE_PAGE
+    ? &reinterpret_cast<buf_block_t*>(bpage)->lock : nullptr;
 
   buf_block_t *block= reinterpret_cast<buf_block_t*>(bpage);
   page_t *frame= bpage->zip.data;
@@ -947,6 +993,19 @@ static bool buf_flush_page(buf_page_t *bpage, bool lru, fil_space_t *space)
 
   /* Increment the I/O operation count used for selecting LRU policy. */
   buf_LRU_stat_inc_io();
+}
+
+/** Write a flushable page from buf_pool to a file.
+buf_pool.mutex must be held.
+@param bpage       buffer control block
+@param lru         true=buf_pool.LRU; false=buf_pool.flush_list
+@param space       tablespace
+@return whether the page was flushed and buf_pool.mutex was released */
+static bool buf_flush_page(buf_page_t *bpage, bool lru, fil_space_t *space)
+{
+  if (!buf_flush_page_fix(bpage, lru, space))
+    return false;
+  buf_flush_page_write(bpage, lru, space);
   return true;
 }
 
@@ -1369,6 +1428,95 @@ static ulint buf_do_LRU_batch(ulint max)
   return n.flushed;
 }
 
+/** Pages of a buf_pool.flush_list batch whose writes are initiated
+by multiple threads. The checksum calculation, encryption and
+page_compressed compression of the pages can be CPU intensive.
+The pages are partitioned by tablespace and page number, so that
+adjacent pages are written by the same thread. */
+class buf_flush_batch_t
+{
+  /** a page that was fixed by buf_flush_page_fix() */
+  struct fixed_page
+  {
+    buf_page_t *bpage;
+    /** tablespace, reacquired for the page */
+    fil_space_t *space;
+  };
+
+  /** maximum number of fixed pages per partition before submit() */
+  static constexpr size_t MAX_PAGES= 64;
+  /** number of partitions */
+  const unsigned n_parts;
+  /** pages to be written by each partition */
+  std::vector<fixed_page> *parts;
+  /** number of fixed pages */
+  size_t n_pages= 0;
+
+  /** Write the pages of a partition.
+  @param arg   std::vector<fixed_page> */
+  static void write_task(void *arg)
+  {
+    auto pages= static_cast<std::vector<fixed_page>*>(arg);
+    for (const fixed_page &p : *pages)
+    {
+      buf_flush_page_write(p.bpage, false, p.space);
+      p.space->release();
+    }
+    pages->clear();
+  }
+
+public:
+  /** Create a batch.
+  @param n  number of partitions */
+  explicit buf_flush_batch_t(unsigned n) :
+    n_parts(n), parts(new std::vector<fixed_page>[n]) {}
+
+  ~buf_flush_batch_t()
+  {
+    ut_ad(!n_pages);
+    delete[] parts;
+  }
+
+  /** Add a page that was fixed by buf_flush_page_fix().
+  @param bpage   buffer page
+  @param space   tablespace */
+  void add(buf_page_t *bpage, fil_space_t *space)
+  {
+    mysql_mutex_assert_not_owner(&buf_pool.mutex);
+    space->reacquire();
+    const page_id_t id{bpage->id()};
+    parts[ut_fold_ulint_pair(id.space(), id.page_no() / 64) % n_parts].
+      push_back({bpage, space});
+    if (++n_pages >= MAX_PAGES * n_parts)
+      submit();
+  }
+
+  /** Initiate the writes of all added pages, and wait for the
+  initiation to complete. */
+  void submit()
+  {
+    mysql_mutex_assert_not_owner(&buf_pool.mutex);
+    if (!n_pages)
+      return;
+    std::vector<tpool::waitable_task*> tasks;
+    for (unsigned i= 1; i < n_parts; i++)
+    {
+      if (parts[i].empty())
+        continue;
+      buf_flush_parallel_page_count+= parts[i].size();
+      tasks.push_back(new tpool::waitable_task(write_task, &parts[i]));
+      srv_thread_pool->submit_task(tasks.back());
+    }
+    write_task(&parts[0]);
+    for (tpool::waitable_task *t : tasks)
+    {
+      t->wait();
+      delete t;
+    }
+    n_pages= 0;
+  }
+};
+
 /** This utility flushes dirty blocks from the end of the flush_list.
 The calling thread is not allowed to own any latches on pages!
 @param max_n    maximum mumber of blocks to flush
@@ -1387,6 +1535,12 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn)
   uint32_t last_space_id= FIL_NULL;
   static_assert(FIL_NULL > SRV_TMP_SPACE_ID, "consistency");
   static_assert(FIL_NULL > SRV_SPACE_ID_UPPER_BOUND, "consistency");
+  /* Use innodb_write_io_threads threads for initiating page writes. */
+  unsigned n_parts= srv_n_write_io_threads;
+  if (max_n / 32 < n_parts)
+    n_parts= unsigned(max_n / 32) + 1;
+  buf_flush_batch_t *batch= n_parts > 1
+    ? new buf_flush_batch_t(n_parts) : nullptr;
 
   /* Start from the end of the list looking for a suitable block to be
   flushed. */
@@ -1459,9 +1613,18 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn)
     reacquire_mutex:
       mysql_mutex_lock(&buf_pool.mutex);
     }
-    else if (buf_flush_page(bpage, false, space))
+    else if (!batch)
+    {
+      if (buf_flush_page(bpage, false, space))
+      {
+        ++count;
+        goto reacquire_mutex;
+      }
+    }
+    else if (buf_flush_page_fix(bpage, false, space))
     {
       ++count;
+      batch->add(bpage, space);
       goto reacquire_mutex;
     }
 
@@ -1472,6 +1635,14 @@ static ulint buf_do_flush_list_batch(ulint max_n, lsn_t lsn)
   buf_pool.flush_hp.set(nullptr);
   mysql_mutex_unlock(&buf_pool.flush_list_mutex);
 
+  if (batch)
+  {
+    mysql_mutex_unlock(&buf_pool.mutex);
+    batch->submit();
+    delete batch;
+    mysql_mutex_lock(&buf_pool.mutex);
+  }
+
   if (space)
     space->release();
 
@@ -38,6 +38,10 @@ Created 11/5/1995 Heikki Tuuri
 #include "srv0srv.h"
 #include "srv0mon.h"
 #include "my_cpu.h"
+#ifdef HAVE_LIBNUMA
+# include <numa.h>
+# include <sched.h>
+#endif
 
 /** Flush this many pages in buf_LRU_get_free_block() */
 size_t innodb_lru_flush_size;
@@ -80,9 +84,19 @@ Updated at SRV_MONITOR_INTERVAL (the buf_LRU_stat_update() call rate). */
 static constexpr ulint BUF_LRU_STAT_N_INTERVAL= 4;
 
 /** Co-efficient with which we multiply I/O operations to equate them
-with page_zip_decompress() operations. */
+with page_zip_decompress() operations, until the latency of page reads
+has been measured. */
 static constexpr ulint BUF_LRU_IO_TO_UNZIP_FACTOR= 50;
 
+/** Average latency of a synchronous page read during the latest
+interval that had any, in microseconds, or 0 if not known yet.
+Updated by buf_LRU_stat_update(). */
+static ulint			buf_LRU_read_us;
+
+/** srv_stats.page_reads_sync and page_reads_sync_us at the
+latest buf_LRU_stat_update() */
+static ulint			buf_LRU_stat_reads, buf_LRU_stat_reads_us;
+
 /** Sampled values buf_LRU_stat_cur.
 Not protected by any mutex.  Updated by buf_LRU_stat_update(). */
 static buf_LRU_stat_t		buf_LRU_stat_arr[BUF_LRU_STAT_N_INTERVAL];
@@ -173,6 +187,20 @@ bool buf_LRU_evict_from_unzip_LRU()
 	ulint	io_avg = buf_LRU_stat_sum.io / BUF_LRU_STAT_N_INTERVAL
 		+ buf_LRU_stat_cur.io;
 
+	if (buf_LRU_read_us) {
+		/* Compare the measured time spent decompressing pages
+		with the time that the I/O would take. If the load is
+		I/O bound, evict an uncompressed frame from unzip_LRU,
+		so that more compressed pages fit in the buffer pool.
+		Otherwise the load is CPU bound; evict from the regular
+		LRU, so that hot pages need not be decompressed again. */
+		ulint	unzip_us_avg = buf_LRU_stat_sum.unzip_us
+			/ BUF_LRU_STAT_N_INTERVAL
+			+ buf_LRU_stat_cur.unzip_us;
+
+		return(unzip_us_avg <= io_avg * buf_LRU_read_us);
+	}
+
 	ulint	unzip_avg = buf_LRU_stat_sum.unzip / BUF_LRU_STAT_N_INTERVAL
 		+ buf_LRU_stat_cur.unzip;
 
@@ -278,16 +306,61 @@ bool buf_LRU_scan_and_free_block(ulint limit)
     buf_LRU_free_from_common_LRU_list(limit);
 }
 
-/** @return a buffer block from the buf_pool.free list
+#ifdef HAVE_LIBNUMA
+/** Maximum number of buf_pool.free blocks to scan for a block that
+resides on the NUMA node of the current thread */
+static constexpr ulint BUF_LRU_NUMA_SCAN_DEPTH = 32;
+
+/** Look for a block on a given NUMA node near the start of buf_pool.free.
+@param node	NUMA node of the current thread, or -1 if unknown
+@return a block on node, or the first block of buf_pool.free */
+static buf_block_t* buf_LRU_get_free_numa_local(int node)
+{
+	buf_page_t*	first = UT_LIST_GET_FIRST(buf_pool.free);
+	ulint		n = node < 0 ? 0 : BUF_LRU_NUMA_SCAN_DEPTH;
+
+	for (buf_page_t* bpage = first; bpage && n--;
+	     bpage = UT_LIST_GET_NEXT(list, bpage)) {
+		buf_block_t* block = reinterpret_cast<buf_block_t*>(bpage);
+		if (block->numa_node == unsigned(node)) {
+			return block;
+		}
+	}
+
+	return reinterpret_cast<buf_block_t*>(first);
+}
+#endif /* HAVE_LIBNUMA */
+
+/** @return the NUMA node of the current thread
+@retval	-1	if innodb_numa_local is not in effect or the node is unknown */
+int buf_LRU_numa_node()
+{
+#ifdef HAVE_LIBNUMA
+	if (srv_numa_local && !srv_numa_interleave) {
+		int cpu = sched_getcpu();
+		if (cpu >= 0) {
+			return numa_node_of_cpu(cpu);
+		}
+	}
+#endif /* HAVE_LIBNUMA */
+	return -1;
+}
+
+/** @param numa_node	NUMA node of the current thread, or -1 for any
+@return a buffer block from the buf_pool.free list
 @retval	NULL	if the free list is empty */
-buf_block_t* buf_LRU_get_free_only()
+buf_block_t* buf_LRU_get_free_only(int numa_node)
 {
 	buf_block_t*	block;
 
 	mysql_mutex_assert_owner(&buf_pool.mutex);
 
+#ifdef HAVE_LIBNUMA
+	block = buf_LRU_get_free_numa_local(numa_node);
+#else
 	block = reinterpret_cast<buf_block_t*>(
 		UT_LIST_GET_FIRST(buf_pool.free));
+#endif
 
 	while (block != NULL) {
 		ut_ad(block->page.in_free_list);
@@ -307,6 +380,15 @@ buf_block_t* buf_LRU_get_free_only()
 
 			block->page.set_state(BUF_BLOCK_MEMORY);
 			MEM_MAKE_ADDRESSABLE(block->frame, srv_page_size);
+#ifdef HAVE_LIBNUMA
+			if (numa_node < 0) {
+				/* innodb_numa_local is not in effect */
+			} else if (block->numa_node == unsigned(numa_node)) {
+				buf_pool.stat.n_numa_local++;
+			} else {
+				buf_pool.stat.n_numa_remote++;
+			}
+#endif
 			break;
 		}
 
@@ -316,8 +398,12 @@ buf_block_t* buf_LRU_get_free_only()
 			&block->page);
 		ut_d(block->in_withdraw_list = true);
 
+#ifdef HAVE_LIBNUMA
+		block = buf_LRU_get_free_numa_local(numa_node);
+#else
 		block = reinterpret_cast<buf_block_t*>(
 			UT_LIST_GET_FIRST(buf_pool.free));
+#endif
 	}
 
 	return(block);
@@ -400,8 +486,9 @@ we put it to free list to be used.
   * scan LRU list even if buf_pool.try_LRU_scan is not set
 
 @param have_mutex  whether buf_pool.mutex is already being held
+@param numa_node   NUMA node of the current thread, or -1 for any
 @return the free control block, in state BUF_BLOCK_MEMORY */
-buf_block_t *buf_LRU_get_free_block(bool have_mutex)
+buf_block_t *buf_LRU_get_free_block(bool have_mutex, int numa_node)
 {
 	ulint		n_iterations	= 0;
 	ulint		flush_failures	= 0;
@@ -422,7 +509,7 @@ buf_block_t *buf_LRU_get_free_block(bool have_mutex)
 
 retry:
 	/* If there is a block in the free list, take it */
-	if ((block = buf_LRU_get_free_only()) != nullptr) {
+	if ((block = buf_LRU_get_free_only(numa_node)) != nullptr) {
 got_block:
 		if (!have_mutex) {
 			mysql_mutex_unlock(&buf_pool.mutex);
@@ -449,7 +536,7 @@ buf_block_t *buf_LRU_get_free_block(bool have_mutex)
 	}
 
 	for (;;) {
-		if ((block = buf_LRU_get_free_only()) != nullptr) {
+		if ((block = buf_LRU_get_free_only(numa_node)) != nullptr) {
 			goto got_block;
 		}
 		if (!buf_pool.n_flush_LRU_) {
@@ -614,6 +701,8 @@ static void buf_unzip_LRU_remove_block_if_needed(buf_page_t* bpage)
 		ut_d(block->in_unzip_LRU_list = false);
 
 		UT_LIST_REMOVE(buf_pool.unzip_LRU, block);
+		buf_pool.buddy_stat[buf_buddy_get_slot(bpage->zip_size())]
+			.unzipped--;
 	}
 }
 
@@ -698,6 +787,9 @@ buf_unzip_LRU_add_block(
 	} else {
 		UT_LIST_ADD_FIRST(buf_pool.unzip_LRU, block);
 	}
+
+	buf_pool.buddy_stat[buf_buddy_get_slot(block->zip_size())]
+		.unzipped++;
 }
 
 /******************************************************************//**
@@ -1293,6 +1385,17 @@ buf_LRU_stat_update()
 {
 	buf_LRU_stat_t*	item;
 	buf_LRU_stat_t	cur_stat;
+	const ulint	reads = srv_stats.page_reads_sync;
+	const ulint	reads_us = srv_stats.page_reads_sync_us;
+
+	if (reads > buf_LRU_stat_reads && reads_us >= buf_LRU_stat_reads_us) {
+		buf_LRU_read_us = std::max<ulint>(
+			1, (reads_us - buf_LRU_stat_reads_us)
+			/ (reads - buf_LRU_stat_reads));
+	}
+
+	buf_LRU_stat_reads = reads;
+	buf_LRU_stat_reads_us = reads_us;
 
 	if (!buf_pool.freed_page_clock) {
 		goto func_exit;
@@ -1313,6 +1416,7 @@ buf_LRU_stat_update()
 
 	buf_LRU_stat_sum.io += cur_stat.io - item->io;
 	buf_LRU_stat_sum.unzip += cur_stat.unzip - item->unzip;
+	buf_LRU_stat_sum.unzip_us += cur_stat.unzip_us - item->unzip_us;
 
 	/* Put current entry in the array. */
 	memcpy(item, &cur_stat, sizeof *item);
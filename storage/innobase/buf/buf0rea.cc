@@ -104,19 +104,28 @@ static buf_page_t* buf_page_init_for_read(ulint mode, const page_id_t page_id,
 
   buf_page_t *bpage= nullptr;
   buf_block_t *block= nullptr;
+
+  /* Acquire buf_pool.mutex only once for allocating the block and
+  for inserting it into buf_pool.page_hash and buf_pool.LRU.
+  On a page miss, this halves the number of buf_pool.mutex
+  acquisitions. buf_LRU_get_free_block() may release and reacquire
+  the mutex, but we will look up buf_pool.page_hash only after that. */
+  const int numa_node= buf_LRU_numa_node();
+  mysql_mutex_lock(&buf_pool.mutex);
+
   if (!zip_size || unzip || recv_recovery_is_on())
   {
-    block= buf_LRU_get_free_block(false);
+    block= buf_LRU_get_free_block(true, numa_node);
     block->initialise(page_id, zip_size);
     /* x_unlock() will be invoked
-    in buf_page_read_complete() by the io-handler thread. */
+    in buf_page_read_complete() by the io-handler thread.
+    Nobody else can be holding a latch on a block that was
+    just allocated from buf_pool.free. */
     block->lock.x_lock(true);
   }
 
   const ulint fold= page_id.fold();
 
-  mysql_mutex_lock(&buf_pool.mutex);
-
   /* We must acquire hash_lock this early to prevent
   a race condition with buf_pool_t::watch_remove() */
   page_hash_latch *hash_lock= buf_pool.page_hash.lock_get(fold);
@@ -458,6 +467,62 @@ buf_read_ahead_random(const page_id_t page_id, ulint zip_size, bool ibuf)
   return count;
 }
 
+/** Issue asynchronous reads for known pages of a tablespace, such as the
+leaf pages that an index range scan is about to reach (innodb_index_read_ahead).
+Pages that already reside in the buffer pool are skipped.
+The calling thread must not hold any page latches.
+@param[in]	space_id	tablespace identifier
+@param[in,out]	pages		page numbers; on return, the first pages
+				are those for which a read was issued
+@param[in]	n		number of elements in pages[]
+@return number of page read requests issued */
+ulint buf_read_ahead_pages(ulint space_id, uint32_t *pages, ulint n)
+{
+  if (srv_startup_is_before_trx_rollback_phase)
+    /* No read-ahead to avoid thread deadlocks */
+    return 0;
+
+  if (buf_pool.n_pend_reads > buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t* space= fil_space_t::get(space_id);
+  if (!space)
+    return 0;
+
+  const ulint zip_size= space->zip_size();
+  ulint count= 0;
+
+  for (ulint i= 0; i < n; i++)
+  {
+    const page_id_t page_id(space_id, pages[i]);
+    if (ibuf_bitmap_page(page_id, zip_size) || trx_sys_hdr_page(page_id))
+      continue;
+    if (space->is_stopping())
+      break;
+    dberr_t err;
+    space->reacquire();
+    if (buf_read_page_low(&err, space, false, BUF_READ_ANY_PAGE, page_id,
+                          zip_size, false))
+      pages[count++]= pages[i];
+  }
+
+  if (count)
+  {
+    DBUG_PRINT("ib_buf", ("index read-ahead %zu pages from %s",
+                          count, space->chain.start->name));
+    /* Read ahead is considered one I/O operation for the purpose of
+    LRU policy decision. */
+    buf_LRU_stat_inc_io();
+  }
+  space->release();
+
+  srv_stats.n_ra_pages_read_index.add(count);
+  srv_stats.buf_pool_reads.add(count);
+  return count;
+}
+
+thread_local buf_read_stats_t *buf_read_stats;
+
 /** High-level function which reads a page from a file to buf_pool
 if it is not already there. Sets the io_fix and an exclusive lock
 on the buffer frame. The flag is cleared and the x-lock
@@ -480,9 +545,20 @@ dberr_t buf_read_page(const page_id_t page_id, ulint zip_size)
   }
 
   dberr_t err;
+  const ulonglong start= my_interval_timer();
   if (buf_read_page_low(&err, space, true, BUF_READ_ANY_PAGE,
 			page_id, zip_size, false))
+  {
+    const ulint us= ulint((my_interval_timer() - start) / 1000);
     srv_stats.buf_pool_reads.add(1);
+    srv_stats.page_reads_sync.inc();
+    srv_stats.page_reads_sync_us.add(us);
+    if (buf_read_stats_t *stats= buf_read_stats)
+    {
+      stats->n_reads++;
+      stats->read_us+= us;
+    }
+  }
 
   buf_LRU_stat_inc_io();
   return err;
@@ -32,6 +32,7 @@ Modified           Jan Lindström jan.lindstrom@mariadb.com
 # include "buf0buf.h"
 #else
 #include "buf0dblwr.h"
+#include "buf0rea.h"
 #include "srv0srv.h"
 #include "srv0start.h"
 #include "mtr0mtr.h"
@@ -84,6 +85,115 @@ static uint n_fil_crypt_iops_allocated;
 /** Statistics variables */
 static fil_crypt_stat_t crypt_stat;
 static mysql_mutex_t crypt_stat_mutex;
+/** When crypt_stat.pages_per_second was computed; protected by
+crypt_stat_mutex */
+static ulonglong crypt_stat_rate_time;
+
+/** The page reads of the key rotation threads, excluding the reads
+of other threads that key rotation waited for */
+static buf_read_stats_t fil_crypt_reads;
+
+/** Key rotation throughput governor, protected by fil_crypt_threads_mutex.
+It limits the IOPS of key rotation below innodb_encryption_rotation_iops
+when the latency of the page reads that other threads are waiting for
+grows, so that key rotation does not starve the foreground workload. */
+static struct
+{
+  /** my_interval_timer() of the latest adjustment */
+  ulonglong time;
+  /** srv_stats.page_reads_sync at the latest adjustment */
+  ulint reads;
+  /** srv_stats.page_reads_sync_us at the latest adjustment */
+  ulint read_us;
+  /** fil_crypt_reads.n_reads at the latest adjustment */
+  ulint crypt_reads;
+  /** fil_crypt_reads.read_us at the latest adjustment */
+  ulint crypt_read_us;
+  /** crypt_stat.pages_modified at the latest adjustment */
+  ulint pages_modified;
+  /** moving average of the foreground page read latency,
+  in microseconds, or 0 if not known yet */
+  ulint avg_latency_us;
+  /** the IOPS limit, unless innodb_encryption_rotation_iops is smaller */
+  uint iops;
+} fil_crypt_governor= {0, 0, 0, 0, 0, 0, 0, UINT_MAX};
+
+/** @return the number of IOPS that key rotation may currently use */
+static uint fil_crypt_iops_limit()
+{
+  mysql_mutex_assert_owner(&fil_crypt_threads_mutex);
+  return std::min(srv_n_fil_crypt_iops, fil_crypt_governor.iops);
+}
+
+/** Adjust the IOPS limit of key rotation, at most once per second.
+If the average latency of the synchronous page reads of other threads
+during the past second exceeds twice its moving average, halve the
+limit. Otherwise, raise it by a tenth of innodb_encryption_rotation_iops.
+Also compute the number of pages rotated per second. */
+static void fil_crypt_governor_update()
+{
+  mysql_mutex_assert_owner(&fil_crypt_threads_mutex);
+
+  const ulonglong now= my_interval_timer();
+  const ulonglong elapsed= now - fil_crypt_governor.time;
+
+  if (elapsed < 1000000000ULL)
+    return;
+
+  const ulint reads= srv_stats.page_reads_sync;
+  const ulint read_us= srv_stats.page_reads_sync_us;
+  const ulint crypt_reads= fil_crypt_reads.n_reads;
+  const ulint crypt_read_us= fil_crypt_reads.read_us;
+  const ulint n= (reads - fil_crypt_governor.reads) -
+    (crypt_reads - fil_crypt_governor.crypt_reads);
+  const ulint us= (read_us - fil_crypt_governor.read_us) -
+    (crypt_read_us - fil_crypt_governor.crypt_read_us);
+  const uint limit= fil_crypt_iops_limit();
+  const bool first= !fil_crypt_governor.time;
+
+  fil_crypt_governor.time= now;
+  fil_crypt_governor.reads= reads;
+  fil_crypt_governor.read_us= read_us;
+  fil_crypt_governor.crypt_reads= crypt_reads;
+  fil_crypt_governor.crypt_read_us= crypt_read_us;
+
+  /* Ignore a second with only a few foreground reads, or where the
+  counters were updated in a different order than we read them. */
+  if (first || n < 10 || ssize_t(n) < 0 || ssize_t(us) < 0)
+    fil_crypt_governor.iops= std::min(srv_n_fil_crypt_iops,
+                                      limit + std::max(1U,
+                                                       srv_n_fil_crypt_iops
+                                                       / 10));
+  else
+  {
+    const ulint latency_us= us / n;
+    ulint &avg= fil_crypt_governor.avg_latency_us;
+
+    if (avg && latency_us > 2 * avg)
+      fil_crypt_governor.iops= std::max(1U, limit / 2);
+    else
+      fil_crypt_governor.iops= std::min(srv_n_fil_crypt_iops,
+                                        limit + std::max(1U,
+                                                         srv_n_fil_crypt_iops
+                                                         / 10));
+    /* Let the average follow a lasting change of the workload. */
+    avg= avg ? (15 * avg + latency_us) / 16 : latency_us;
+  }
+
+  DBUG_PRINT("ib_crypt", ("rotation iops limit %u", fil_crypt_iops_limit()));
+
+  if (fil_crypt_iops_limit() > limit)
+    pthread_cond_broadcast(&fil_crypt_threads_cond);
+
+  mysql_mutex_lock(&crypt_stat_mutex);
+  crypt_stat_rate_time= now;
+  crypt_stat.pages_per_second= first ? 0 : ulint(
+    (crypt_stat.pages_modified - fil_crypt_governor.pages_modified) *
+    1000000000ULL / elapsed);
+  fil_crypt_governor.pages_modified= crypt_stat.pages_modified;
+  crypt_stat.allowed_iops= fil_crypt_iops_limit();
+  mysql_mutex_unlock(&crypt_stat_mutex);
+}
 
 /** Wake up the encryption threads */
 void fil_crypt_threads_signal(bool broadcast)
@@ -1275,15 +1385,16 @@ static bool fil_crypt_alloc_iops(rotate_thread_t *state)
 	its status yet. */
 
 	uint max_iops = state->estimated_max_iops;
+	const uint limit = fil_crypt_iops_limit();
 
-	if (n_fil_crypt_iops_allocated >= srv_n_fil_crypt_iops) {
+	if (n_fil_crypt_iops_allocated >= limit) {
 wait:
 		my_cond_wait(&fil_crypt_threads_cond,
 			     &fil_crypt_threads_mutex.m_mutex);
 		return false;
 	}
 
-	uint alloc = srv_n_fil_crypt_iops - n_fil_crypt_iops_allocated;
+	uint alloc = limit - n_fil_crypt_iops_allocated;
 
 	if (alloc > max_iops) {
 		alloc = max_iops;
@@ -1345,6 +1456,11 @@ static bool fil_crypt_realloc_iops(rotate_thread_t *state)
 		return false;
 	}
 
+	fil_crypt_update_total_stat(state);
+	fil_crypt_governor_update();
+
+	const uint limit = fil_crypt_iops_limit();
+
 	if (state->allocated_iops > state->estimated_max_iops) {
 		/* release iops */
 		uint extra = state->allocated_iops - state->estimated_max_iops;
@@ -1352,9 +1468,16 @@ static bool fil_crypt_realloc_iops(rotate_thread_t *state)
 		ut_ad(n_fil_crypt_iops_allocated >= extra);
 		n_fil_crypt_iops_allocated -= extra;
 		pthread_cond_broadcast(&fil_crypt_threads_cond);
-	} else if (srv_n_fil_crypt_iops > n_fil_crypt_iops_allocated) {
+	} else if (n_fil_crypt_iops_allocated > limit
+		   && state->allocated_iops > 1) {
+		/* the governor reduced the limit; release iops */
+		uint extra = std::min(n_fil_crypt_iops_allocated - limit,
+				      state->allocated_iops - 1);
+		state->allocated_iops -= extra;
+		n_fil_crypt_iops_allocated -= extra;
+	} else if (limit > n_fil_crypt_iops_allocated) {
 		/* there are extra iops free */
-		uint add = srv_n_fil_crypt_iops - n_fil_crypt_iops_allocated;
+		uint add = limit - n_fil_crypt_iops_allocated;
 		if (state->allocated_iops + add > state->estimated_max_iops) {
 			/* but don't alloc more than our max */
 			add= state->estimated_max_iops - state->allocated_iops;
@@ -1369,7 +1492,6 @@ static bool fil_crypt_realloc_iops(rotate_thread_t *state)
 			    state->allocated_iops));
 	}
 
-	fil_crypt_update_total_stat(state);
 	mysql_mutex_unlock(&fil_crypt_threads_mutex);
 	return true;
 }
@@ -2074,6 +2196,10 @@ static void fil_crypt_complete_rotate_space(rotate_thread_t* state)
 accordingly */
 static void fil_crypt_thread()
 {
+	/* Let the governor tell our own page reads apart from those
+	of the foreground threads. */
+	buf_read_stats = &fil_crypt_reads;
+
 	mysql_mutex_lock(&fil_crypt_threads_mutex);
 	rotate_thread_t thr(srv_n_fil_crypt_threads_started++);
 	pthread_cond_signal(&fil_crypt_cond); /* signal that we started */
@@ -2421,7 +2547,13 @@ void fil_crypt_total_stat(fil_crypt_stat_t *stat)
 {
 	mysql_mutex_lock(&crypt_stat_mutex);
 	*stat = crypt_stat;
+	const ulonglong rate_time = crypt_stat_rate_time;
 	mysql_mutex_unlock(&crypt_stat_mutex);
+
+	if (my_interval_timer() - rate_time > 2000000000ULL) {
+		/* No key rotation took place recently. */
+		stat->pages_per_second = 0;
+	}
 }
 
 #endif /* UNIV_INNOCHECKSUM */
@@ -281,6 +281,9 @@ static bool fil_comp_algo_validate(const fil_space_t* space)
 #ifdef HAVE_SNAPPY
 	case PAGE_SNAPPY_ALGORITHM:
 #endif /* HAVE_SNAPPY */
+#ifdef HAVE_ZSTD
+	case PAGE_ZSTD_ALGORITHM:
+#endif /* HAVE_ZSTD */
 		return true;
 	}
 
@@ -2863,7 +2866,7 @@ fil_io_t fil_space_t::io(const IORequest &type, os_offset_t offset, size_t len,
 		goto release_sync_write;
 	} else {
 		/* Queue the aio request */
-		err = os_aio(IORequest(bpage, node, type.type),
+		err = os_aio(IORequest(bpage, node, type.type, type.n_pages),
 			     buf, offset, len);
 	}
 
@@ -55,135 +55,6 @@ Updated 14/02/2015
 #include <fcntl.h>
 #endif
 #include "row0mysql.h"
-#ifdef HAVE_LZ4
-#include "lz4.h"
-#endif
-#ifdef HAVE_LZO
-#include "lzo/lzo1x.h"
-#endif
-#ifdef HAVE_LZMA
-#include "lzma.h"
-#endif
-#ifdef HAVE_BZIP2
-#include "bzlib.h"
-#endif
-#ifdef HAVE_SNAPPY
-#include "snappy-c.h"
-#endif
-
-/** Compress a page for the given compression algorithm.
-@param[in]	buf		page to be compressed
-@param[out]	out_buf		compressed page
-@param[in]	header_len	header length of the page
-@param[in]	comp_algo	compression algorithm
-@param[in]	comp_level	compression level
-@return actual length of compressed page data
-@retval 0 if the page was not compressed */
-static ulint fil_page_compress_low(
-	const byte*	buf,
-	byte*		out_buf,
-	ulint		header_len,
-	ulint		comp_algo,
-	unsigned	comp_level)
-{
-	ulint write_size = srv_page_size - header_len;
-
-	switch (comp_algo) {
-	default:
-		ut_ad("unknown compression method" == 0);
-		/* fall through */
-	case PAGE_UNCOMPRESSED:
-		return 0;
-	case PAGE_ZLIB_ALGORITHM:
-		{
-			ulong len = uLong(write_size);
-			if (Z_OK == compress2(
-				    out_buf + header_len, &len, buf,
-				    uLong(srv_page_size), int(comp_level))) {
-				return len;
-			}
-		}
-		break;
-#ifdef HAVE_LZ4
-	case PAGE_LZ4_ALGORITHM:
-# ifdef HAVE_LZ4_COMPRESS_DEFAULT
-		write_size = LZ4_compress_default(
-			reinterpret_cast<const char*>(buf),
-			reinterpret_cast<char*>(out_buf) + header_len,
-			int(srv_page_size), int(write_size));
-# else
-		write_size = LZ4_compress_limitedOutput(
-			reinterpret_cast<const char*>(buf),
-			reinterpret_cast<char*>(out_buf) + header_len,
-			int(srv_page_size), int(write_size));
-# endif
-
-		return write_size;
-#endif /* HAVE_LZ4 */
-#ifdef HAVE_LZO
-	case PAGE_LZO_ALGORITHM: {
-		lzo_uint len = write_size;
-
-		if (LZO_E_OK == lzo1x_1_15_compress(
-			    buf, srv_page_size,
-			    out_buf + header_len, &len,
-			    out_buf + srv_page_size)
-		    && len <= write_size) {
-			return len;
-		}
-		break;
-	}
-#endif /* HAVE_LZO */
-#ifdef HAVE_LZMA
-	case PAGE_LZMA_ALGORITHM: {
-		size_t out_pos = 0;
-
-		if (LZMA_OK == lzma_easy_buffer_encode(
-			    comp_level, LZMA_CHECK_NONE, NULL,
-			    buf, srv_page_size, out_buf + header_len,
-			    &out_pos, write_size)
-		     && out_pos <= write_size) {
-			return out_pos;
-		}
-		break;
-	}
-#endif /* HAVE_LZMA */
-
-#ifdef HAVE_BZIP2
-	case PAGE_BZIP2_ALGORITHM: {
-		unsigned len = unsigned(write_size);
-		if (BZ_OK == BZ2_bzBuffToBuffCompress(
-			    reinterpret_cast<char*>(out_buf + header_len),
-			    &len,
-			    const_cast<char*>(
-				    reinterpret_cast<const char*>(buf)),
-			    unsigned(srv_page_size), 1, 0, 0)
-		    && len <= write_size) {
-			return len;
-		}
-		break;
-	}
-#endif /* HAVE_BZIP2 */
-
-#ifdef HAVE_SNAPPY
-	case PAGE_SNAPPY_ALGORITHM: {
-		size_t len = snappy_max_compressed_length(srv_page_size);
-
-		if (SNAPPY_OK == snappy_compress(
-			    reinterpret_cast<const char*>(buf),
-			    srv_page_size,
-			    reinterpret_cast<char*>(out_buf) + header_len,
-			    &len)
-		    && len <= write_size) {
-			return len;
-		}
-		break;
-	}
-#endif /* HAVE_SNAPPY */
-	}
-
-	return 0;
-}
 
 /** Compress a page_compressed page for full crc32 format.
 @param[in]	buf		page to be compressed
@@ -405,96 +276,6 @@ ulint fil_page_compress(
 			buf, out_buf, flags, block_size, encrypted);
 }
 
-/** Decompress a page that may be subject to page_compressed compression.
-@param[in,out]	tmp_buf		temporary buffer (of innodb_page_size)
-@param[in,out]	buf		possibly compressed page buffer
-@param[in]	comp_algo	compression algorithm
-@param[in]	header_len	header length of the page
-@param[in]	actual size	actual size of the page
-@retval true if the page is decompressed or false */
-static bool fil_page_decompress_low(
-	byte*		tmp_buf,
-	byte*		buf,
-	ulint		comp_algo,
-	ulint		header_len,
-	ulint		actual_size)
-{
-	switch (comp_algo) {
-	default:
-		ib::error() << "Unknown compression algorithm "
-			    << comp_algo;
-		return false;
-	case PAGE_ZLIB_ALGORITHM:
-		{
-			uLong len = srv_page_size;
-			return (Z_OK == uncompress(tmp_buf, &len,
-					       buf + header_len,
-					       uLong(actual_size))
-				&& len == srv_page_size);
-		}
-#ifdef HAVE_LZ4
-	case PAGE_LZ4_ALGORITHM:
-		return LZ4_decompress_safe(
-			reinterpret_cast<const char*>(buf) + header_len,
-			reinterpret_cast<char*>(tmp_buf),
-			static_cast<int>(actual_size),
-			static_cast<int>(srv_page_size)) ==
-			static_cast<int>(srv_page_size);
-#endif /* HAVE_LZ4 */
-#ifdef HAVE_LZO
-	case PAGE_LZO_ALGORITHM:
-		{
-			lzo_uint len_lzo = srv_page_size;
-			return (LZO_E_OK == lzo1x_decompress_safe(
-					buf + header_len,
-					actual_size, tmp_buf, &len_lzo, NULL)
-				&& len_lzo == srv_page_size);
-		}
-#endif /* HAVE_LZO */
-#ifdef HAVE_LZMA
-	case PAGE_LZMA_ALGORITHM:
-		{
-			size_t		src_pos = 0;
-			size_t		dst_pos = 0;
-			uint64_t 	memlimit = UINT64_MAX;
-
-			return LZMA_OK == lzma_stream_buffer_decode(
-				&memlimit, 0, NULL, buf + header_len,
-				&src_pos, actual_size, tmp_buf, &dst_pos,
-				srv_page_size)
-				&& dst_pos == srv_page_size;
-		}
-#endif /* HAVE_LZMA */
-#ifdef HAVE_BZIP2
-	case PAGE_BZIP2_ALGORITHM:
-		{
-			uint dst_pos = static_cast<uint>(srv_page_size);
-			return BZ_OK == BZ2_bzBuffToBuffDecompress(
-				reinterpret_cast<char*>(tmp_buf),
-				&dst_pos,
-				reinterpret_cast<char*>(buf) + header_len,
-				static_cast<uint>(actual_size), 1, 0)
-				&& dst_pos == srv_page_size;
-		}
-#endif /* HAVE_BZIP2 */
-#ifdef HAVE_SNAPPY
-	case PAGE_SNAPPY_ALGORITHM:
-		{
-			size_t olen = srv_page_size;
-
-			return SNAPPY_OK == snappy_uncompress(
-				reinterpret_cast<const char*>(buf)
-				+ header_len,
-				actual_size,
-				reinterpret_cast<char*>(tmp_buf), &olen)
-				&& olen == srv_page_size;
-		}
-#endif /* HAVE_SNAPPY */
-	}
-
-	return false;
-}
-
 /** Decompress a page for full crc32 format.
 @param[in,out]	tmp_buf	temporary buffer (of innodb_page_size)
 @param[in,out]	buf	possibly compressed page buffer
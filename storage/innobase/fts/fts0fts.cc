@@ -2536,8 +2536,10 @@ fts_get_next_doc_id(
 /*********************************************************************//**
 This function fetch the Doc ID from CONFIG table, and compare with
 the Doc ID supplied. And store the larger one to the CONFIG table.
+The new value of fts_cache_t::synced_doc_id is returned to the caller,
+which must publish it while holding fts_cache_t::lock.
 @return DB_SUCCESS if OK */
-static MY_ATTRIBUTE((nonnull))
+static MY_ATTRIBUTE((nonnull(1, 4)))
 dberr_t
 fts_cmp_set_sync_doc_id(
 /*====================*/
@@ -2545,10 +2547,13 @@ fts_cmp_set_sync_doc_id(
 	doc_id_t		cmp_doc_id,	/*!< in: Doc ID to compare */
 	ibool			read_only,	/*!< in: TRUE if read the
 						synced_doc_id only */
-	doc_id_t*		doc_id)		/*!< out: larger document id
+	doc_id_t*		doc_id,		/*!< out: larger document id
 						after comparing "cmp_doc_id"
 						to the one stored in CONFIG
 						table */
+	doc_id_t*		synced_doc_id = NULL)
+						/*!< out: synced Doc ID;
+						required unless read_only */
 {
 	if (srv_read_only_mode) {
 		return DB_READ_ONLY;
@@ -2617,23 +2622,25 @@ fts_cmp_set_sync_doc_id(
 		goto func_exit;
 	}
 
+	ut_ad(synced_doc_id);
+
 	if (cmp_doc_id == 0 && *doc_id) {
-		cache->synced_doc_id = *doc_id - 1;
+		*synced_doc_id = *doc_id - 1;
 	} else {
-		cache->synced_doc_id = ut_max(cmp_doc_id, *doc_id);
+		*synced_doc_id = ut_max(cmp_doc_id, *doc_id);
 	}
 
 	mysql_mutex_lock(&cache->doc_id_lock);
 	/* For each sync operation, we will add next_doc_id by 1,
 	so to mark a sync operation */
-	if (cache->next_doc_id < cache->synced_doc_id + 1) {
-		cache->next_doc_id = cache->synced_doc_id + 1;
+	if (cache->next_doc_id < *synced_doc_id + 1) {
+		cache->next_doc_id = *synced_doc_id + 1;
 	}
 	mysql_mutex_unlock(&cache->doc_id_lock);
 
 	if (cmp_doc_id > *doc_id) {
 		error = fts_update_sync_doc_id(
-			table, cache->synced_doc_id, trx);
+			table, *synced_doc_id, trx);
 	}
 
 	*doc_id = cache->next_doc_id;
@@ -3820,8 +3827,8 @@ static MY_ATTRIBUTE((nonnull, warn_unused_result))
 dberr_t
 fts_sync_add_deleted_cache(
 /*=======================*/
-	fts_sync_t*	sync,			/*!< in: sync state */
-	ib_vector_t*	doc_ids)		/*!< in: doc ids to add */
+	fts_sync_t*		sync,		/*!< in: sync state */
+	std::vector<doc_id_t>&	doc_ids)	/*!< in/out: doc ids to add */
 {
 	ulint		i;
 	pars_info_t*	info;
@@ -3830,11 +3837,11 @@ fts_sync_add_deleted_cache(
 	char		table_name[MAX_FULL_NAME_LEN];
 	doc_id_t	dummy = 0;
 	dberr_t		error = DB_SUCCESS;
-	ulint		n_elems = ib_vector_size(doc_ids);
+	ulint		n_elems = doc_ids.size();
 
-	ut_a(ib_vector_size(doc_ids) > 0);
+	ut_a(n_elems > 0);
 
-	ib_vector_sort(doc_ids, fts_doc_id_cmp);
+	std::sort(doc_ids.begin(), doc_ids.end());
 
 	info = pars_info_create();
 
@@ -3852,13 +3859,10 @@ fts_sync_add_deleted_cache(
 		"BEGIN INSERT INTO $table_name VALUES (:doc_id);");
 
 	for (i = 0; i < n_elems && error == DB_SUCCESS; ++i) {
-		doc_id_t*	update;
 		doc_id_t	write_doc_id;
 
-		update = static_cast<doc_id_t*>(ib_vector_get(doc_ids, i));
-
 		/* Convert to "storage" byte order. */
-		fts_write_doc_id((byte*) &write_doc_id, *update);
+		fts_write_doc_id((byte*) &write_doc_id, doc_ids[i]);
 		fts_bind_doc_id(info, "doc_id", &write_doc_id);
 
 		error = fts_eval_sql(sync->trx, graph);
@@ -4091,19 +4095,20 @@ fts_sync_commit(
 
 	trx->op_info = "doing SYNC commit";
 
-	/* After each Sync, update the CONFIG table about the max doc id
-	we just sync-ed to index table */
-	error = fts_cmp_set_sync_doc_id(sync->table, sync->max_doc_id, FALSE,
-					&last_doc_id);
+	/* All words have been written. Detach the rest of the state that
+	is to be persisted and empty the cache, so that fts_cache_add_doc()
+	will not be blocked while the CONFIG and DELETED_CACHE tables
+	are being updated. */
+	const doc_id_t	max_doc_id = sync->max_doc_id;
 
 	/* Get the list of deleted documents that are either in the
 	cache or were headed there but were deleted before the add
 	thread got to them. */
+	std::vector<doc_id_t>	deleted;
 
-	if (error == DB_SUCCESS && ib_vector_size(cache->deleted_doc_ids) > 0) {
-
-		error = fts_sync_add_deleted_cache(
-			sync, cache->deleted_doc_ids);
+	for (ulint i = 0; i < ib_vector_size(cache->deleted_doc_ids); i++) {
+		deleted.push_back(*static_cast<doc_id_t*>(
+			ib_vector_get(cache->deleted_doc_ids, i)));
 	}
 
 	/* We need to do this within the deleted lock since fts_delete() can
@@ -4112,6 +4117,26 @@ fts_sync_commit(
 	DEBUG_SYNC_C("fts_deleted_doc_ids_clear");
 	fts_cache_init(cache);
 	mysql_mutex_unlock(&cache->lock);
+	DEBUG_SYNC_C("fts_sync_commit");
+
+	/* After each Sync, update the CONFIG table about the max doc id
+	we just sync-ed to index table. The CONFIG table is written
+	without holding cache->lock; only the resulting synced_doc_id
+	is published under it. */
+	doc_id_t	synced_doc_id;
+
+	error = fts_cmp_set_sync_doc_id(sync->table, max_doc_id, FALSE,
+					&last_doc_id, &synced_doc_id);
+
+	if (error == DB_SUCCESS) {
+		mysql_mutex_lock(&cache->lock);
+		cache->synced_doc_id = synced_doc_id;
+		mysql_mutex_unlock(&cache->lock);
+	}
+
+	if (error == DB_SUCCESS && !deleted.empty()) {
+		error = fts_sync_add_deleted_cache(sync, deleted);
+	}
 
 	if (UNIV_LIKELY(error == DB_SUCCESS)) {
 		fts_sql_commit(trx);
@@ -4232,53 +4257,66 @@ fts_sync(
 	DEBUG_SYNC_C("fts_sync_begin");
 	fts_sync_begin(sync);
 
-begin_sync:
-	if (cache->total_size > fts_max_cache_size) {
-		/* Avoid the case: sync never finish when
-		insert/update keeps comming. */
-		ut_ad(sync->unlock_cache);
-		sync->unlock_cache = false;
-	}
+	/* Write out the bulk of the cache in the first round, even if
+	it has exceeded innodb_ft_cache_size, without blocking
+	fts_cache_add_doc() for the duration of the whole SYNC. */
+	for (bool first_round = true;; first_round = false) {
+		if (!first_round
+		    && cache->total_size > fts_max_cache_size) {
+			/* Avoid the case: sync never finish when
+			insert/update keeps comming. */
+			ut_ad(sync->unlock_cache);
+			sync->unlock_cache = false;
+		}
 
-	for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
-		fts_index_cache_t*	index_cache;
+		for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
+			fts_index_cache_t*	index_cache;
 
-		index_cache = static_cast<fts_index_cache_t*>(
-			ib_vector_get(cache->indexes, i));
+			index_cache = static_cast<fts_index_cache_t*>(
+				ib_vector_get(cache->indexes, i));
 
-		if (index_cache->index->to_be_dropped) {
-			continue;
-		}
+			if (index_cache->index->to_be_dropped) {
+				continue;
+			}
 
-		DBUG_EXECUTE_IF("fts_instrument_sync_before_syncing",
-				std::this_thread::sleep_for(
-					std::chrono::milliseconds(300)););
-		error = fts_sync_index(sync, index_cache);
+			DBUG_EXECUTE_IF("fts_instrument_sync_before_syncing",
+					std::this_thread::sleep_for(
+						std::chrono::milliseconds(
+							300)););
+			error = fts_sync_index(sync, index_cache);
 
-		if (error != DB_SUCCESS) {
-			goto end_sync;
+			if (error != DB_SUCCESS) {
+				goto end_sync;
+			}
 		}
-	}
 
-	DBUG_EXECUTE_IF("fts_instrument_sync_interrupted",
-			sync->interrupted = true;
-			error = DB_INTERRUPTED;
-			goto end_sync;
-	);
+		DBUG_EXECUTE_IF("fts_instrument_sync_interrupted",
+				sync->interrupted = true;
+				error = DB_INTERRUPTED;
+				goto end_sync;
+		);
 
-	/* Make sure all the caches are synced. */
-	for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
-		fts_index_cache_t*	index_cache;
+		/* Make sure all the caches are synced. Words that were
+		added while the cache was unlocked are written out in
+		the next round. */
+		bool	all_synced = true;
 
-		index_cache = static_cast<fts_index_cache_t*>(
-			ib_vector_get(cache->indexes, i));
+		for (i = 0; i < ib_vector_size(cache->indexes); ++i) {
+			fts_index_cache_t*	index_cache;
 
-		if (index_cache->index->to_be_dropped
-		    || fts_sync_index_check(index_cache)) {
-			continue;
+			index_cache = static_cast<fts_index_cache_t*>(
+				ib_vector_get(cache->indexes, i));
+
+			if (!index_cache->index->to_be_dropped
+			    && !fts_sync_index_check(index_cache)) {
+				all_synced = false;
+				break;
+			}
 		}
 
-		goto begin_sync;
+		if (all_synced) {
+			break;
+		}
 	}
 
 end_sync:
@@ -4766,7 +4804,12 @@ fts_init_doc_id(
 
 	/* Then compare this value with the ID value stored in the CONFIG
 	table. The larger one will be our new initial Doc ID */
-	fts_cmp_set_sync_doc_id(table, 0, FALSE, &max_doc_id);
+	doc_id_t	synced_doc_id;
+
+	if (fts_cmp_set_sync_doc_id(table, 0, FALSE, &max_doc_id,
+				    &synced_doc_id) == DB_SUCCESS) {
+		table->fts->cache->synced_doc_id = synced_doc_id;
+	}
 
 	/* If DICT_TF2_FTS_ADD_DOC_ID is set, we are in the process of
 	creating index (and add doc id column. No need to recovery
@@ -36,6 +36,7 @@ Completed 2011/7/10 Sunny and Jimmy Yang
 #include "fts0plugin.h"
 
 #include <iomanip>
+#include <queue>
 #include <vector>
 
 #define FTS_ELEM(t, n, i, j) (t[(i) * n + (j)])
@@ -4163,12 +4164,21 @@ fts_query_free_result(
 	}
 }
 
-/*****************************************************************//**
-FTS Query sort result, returned by fts_query() on fts_ranking_t::rank. */
-void
-fts_query_sort_result_on_rank(
-/*==========================*/
-	fts_result_t*	result)		/*!< out: result instance to sort.*/
+/** Determine whether a document is ranked before another one.
+This is the order of fts_query_sort_result_on_rank(): by descending rank,
+and documents of the same rank by ascending doc_id.
+@return whether r1 is ranked before r2 */
+static bool fts_ranked_before(const fts_ranking_t* r1, const fts_ranking_t* r2)
+{
+	return r1->rank > r2->rank
+		|| (r1->rank == r2->rank && r1->doc_id < r2->doc_id);
+}
+
+/** Sort the result returned by fts_query() on fts_ranking_t::rank.
+@param[in,out]	result	result of fts_query()
+@param[in]	limit	number of top ranked documents to sort, or
+			ULINT_UNDEFINED to sort all of them */
+void fts_query_sort_result_on_rank(fts_result_t* result, ulint limit)
 {
 	const ib_rbt_node_t*	node;
 	ib_rbt_t*		ranked;
@@ -4179,9 +4189,45 @@ fts_query_sort_result_on_rank(
 	}
 
 	ranked = rbt_create(sizeof(fts_ranking_t), fts_query_compare_rank);
+	limit = std::max<ulint>(limit, 1);
+	result->partially_ranked = limit < rbt_size(result->rankings_by_id);
+
+	if (result->partially_ranked) {
+		/* Find the lowest ranked document among the top ones,
+		keeping the lowest ranked candidate on the top of
+		a bounded heap. */
+		struct cmp {
+			bool operator()(const fts_ranking_t* r1,
+					const fts_ranking_t* r2) const
+			{
+				return fts_ranked_before(r1, r2);
+			}
+		};
+		std::vector<const fts_ranking_t*>	heap;
+		heap.reserve(limit);
+		std::priority_queue<const fts_ranking_t*,
+				    std::vector<const fts_ranking_t*>, cmp>
+			top(cmp(), std::move(heap));
 
-	/* We need to free any instances of fts_doc_freq_t that we
-	may have allocated. */
+		for (node = rbt_first(result->rankings_by_id);
+		     node;
+		     node = rbt_next(result->rankings_by_id, node)) {
+			const fts_ranking_t*	ranking
+				= rbt_value(fts_ranking_t, node);
+
+			if (top.size() < limit) {
+				top.push(ranking);
+			} else if (fts_ranked_before(ranking, top.top())) {
+				top.pop();
+				top.push(ranking);
+			}
+		}
+
+		result->rank_bound = *top.top();
+	}
+
+	/* Inserting in doc_id order makes documents of the same rank
+	end up in the order of fts_ranked_before(). */
 	for (node = rbt_first(result->rankings_by_id);
 	     node;
 	     node = rbt_next(result->rankings_by_id, node)) {
@@ -4192,7 +4238,10 @@ fts_query_sort_result_on_rank(
 
 		ut_a(ranking->words == NULL);
 
-		rbt_insert(ranked, ranking, ranking);
+		if (!result->partially_ranked
+		    || !fts_ranked_before(&result->rank_bound, ranking)) {
+			rbt_insert(ranked, ranking, ranking);
+		}
 	}
 
 	/* Reset the current node too. */
@@ -4200,6 +4249,42 @@ fts_query_sort_result_on_rank(
 	result->rankings_by_rank = ranked;
 }
 
+/** Advance fts_result_t::current to the next document in rank order.
+If only the top ranked documents were sorted and all of them have been
+visited, the remaining documents will be sorted.
+@param[in,out]	result	result of fts_query() */
+void fts_query_next_on_rank(fts_result_t* result)
+{
+	ut_ad(result->current);
+
+	result->current = const_cast<ib_rbt_node_t*>(
+		rbt_next(result->rankings_by_rank, result->current));
+
+	if (result->current || !result->partially_ranked) {
+		return;
+	}
+
+	/* The caller read more rows than it asked for, for example
+	because some of the documents were not visible. */
+	ib_rbt_t*	ranked = rbt_create(
+		sizeof(fts_ranking_t), fts_query_compare_rank);
+
+	for (const ib_rbt_node_t* node = rbt_first(result->rankings_by_id);
+	     node;
+	     node = rbt_next(result->rankings_by_id, node)) {
+		fts_ranking_t*	ranking = rbt_value(fts_ranking_t, node);
+
+		if (fts_ranked_before(&result->rank_bound, ranking)) {
+			rbt_insert(ranked, ranking, ranking);
+		}
+	}
+
+	rbt_free(result->rankings_by_rank);
+	result->rankings_by_rank = ranked;
+	result->partially_ranked = false;
+	result->current = const_cast<ib_rbt_node_t*>(rbt_first(ranked));
+}
+
 /*******************************************************************//**
 A debug function to print result doc_id set. */
 static
@@ -840,6 +840,7 @@ static ibool innodb_have_lz4=IF_LZ4(1, 0);
 static ibool innodb_have_lzma=IF_LZMA(1, 0);
 static ibool innodb_have_bzip2=IF_BZIP2(1, 0);
 static ibool innodb_have_snappy=IF_SNAPPY(1, 0);
+static ibool innodb_have_zstd=IF_ZSTD(1, 0);
 static ibool innodb_have_punch_hole=IF_PUNCH_HOLE(1, 0);
 
 static
@@ -873,6 +874,17 @@ static MYSQL_THDVAR_UINT(lock_wait_timeout, PLUGIN_VAR_RQCMDARG,
   "Timeout in seconds an InnoDB transaction may wait for a lock before being rolled back. The value 100000000 is infinite timeout.",
   NULL, NULL, 50, 0, 100000000, 0);
 
+static MYSQL_THDVAR_UINT(ddl_threads, PLUGIN_VAR_RQCMDARG,
+  "Maximum number of threads for merge-sorting and inserting"
+  " index records in ALTER TABLE.",
+  NULL, NULL, 4, 1, 64, 0);
+
+static MYSQL_THDVAR_BOOL(bulk_insert_buffer, PLUGIN_VAR_OPCMDARG,
+  "Buffer and sort the rows of INSERT...SELECT, LOAD DATA or a multi-row"
+  " INSERT into an empty table, and load each index in bulk"
+  " at the end of the statement.",
+  NULL, NULL, FALSE);
+
 static MYSQL_THDVAR_STR(ft_user_stopword_table,
   PLUGIN_VAR_OPCMDARG|PLUGIN_VAR_MEMALLOC,
   "User supplied stopword table name, effective in the session level.",
@@ -888,6 +900,8 @@ static SHOW_VAR innodb_status_variables[]= {
   {"adaptive_hash_hash_searches", &export_vars.innodb_ahi_hit, SHOW_SIZE_T},
   {"adaptive_hash_non_hash_searches",
   &export_vars.innodb_ahi_miss, SHOW_SIZE_T},
+  {"adaptive_hash_latch_fails",
+  &export_vars.innodb_ahi_latch_fail, SHOW_SIZE_T},
 #endif
   {"background_log_sync", &srv_log_writes_and_flush, SHOW_SIZE_T},
   {"buffer_pool_dump_status",
@@ -907,6 +921,8 @@ static SHOW_VAR innodb_status_variables[]= {
   {"buffer_pool_bytes_dirty",
    &export_vars.innodb_buffer_pool_bytes_dirty, SHOW_SIZE_T},
   {"buffer_pool_pages_flushed", &buf_flush_page_count, SHOW_SIZE_T},
+  {"buffer_pool_pages_flushed_parallel", &buf_flush_parallel_page_count,
+   SHOW_SIZE_T},
   {"buffer_pool_pages_free",
    &export_vars.innodb_buffer_pool_pages_free, SHOW_SIZE_T},
 #ifdef UNIV_DEBUG
@@ -931,6 +947,12 @@ static SHOW_VAR innodb_status_variables[]= {
    &export_vars.innodb_buffer_pool_read_ahead, SHOW_SIZE_T},
   {"buffer_pool_read_ahead_evicted",
    &export_vars.innodb_buffer_pool_read_ahead_evicted, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_index",
+   &export_vars.innodb_buffer_pool_read_ahead_index, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_index_useful",
+   &export_vars.innodb_buffer_pool_read_ahead_index_useful, SHOW_SIZE_T},
+  {"buffer_pool_read_ahead_index_wasted",
+   &export_vars.innodb_buffer_pool_read_ahead_index_wasted, SHOW_SIZE_T},
   {"buffer_pool_read_requests",
    &export_vars.innodb_buffer_pool_read_requests, SHOW_SIZE_T},
   {"buffer_pool_reads",
@@ -948,6 +970,8 @@ static SHOW_VAR innodb_status_variables[]= {
   {"data_reads", &export_vars.innodb_data_reads, SHOW_SIZE_T},
   {"data_writes", &export_vars.innodb_data_writes, SHOW_SIZE_T},
   {"data_written", &export_vars.innodb_data_written, SHOW_SIZE_T},
+  {"data_write_avg_bytes", &export_vars.innodb_data_write_avg_bytes,
+   SHOW_SIZE_T},
   {"dblwr_pages_written", &export_vars.innodb_dblwr_pages_written,SHOW_SIZE_T},
   {"dblwr_writes", &export_vars.innodb_dblwr_writes, SHOW_SIZE_T},
   {"deadlocks", &lock_sys.deadlocks, SHOW_SIZE_T},
@@ -980,7 +1004,11 @@ static SHOW_VAR innodb_status_variables[]= {
   {"mem_adaptive_hash", &export_vars.innodb_mem_adaptive_hash, SHOW_SIZE_T},
 #endif
   {"mem_dictionary", &export_vars.innodb_mem_dictionary, SHOW_SIZE_T},
+  {"os_log_fsync_batch_avg", &export_vars.innodb_os_log_fsync_batch_avg,
+   SHOW_SIZE_T},
   {"os_log_fsyncs", &export_vars.innodb_os_log_fsyncs, SHOW_SIZE_T},
+  {"os_log_fsyncs_saved", &export_vars.innodb_os_log_fsyncs_saved,
+   SHOW_SIZE_T},
   {"os_log_pending_fsyncs", &export_vars.innodb_os_log_pending_fsyncs,
    SHOW_SIZE_T},
   {"os_log_pending_writes", &export_vars.innodb_os_log_pending_writes,
@@ -990,14 +1018,20 @@ static SHOW_VAR innodb_status_variables[]= {
   {"pages_created", &buf_pool.stat.n_pages_created, SHOW_SIZE_T},
   {"pages_read", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
   {"pages_written", &buf_pool.stat.n_pages_written, SHOW_SIZE_T},
+  {"read_views_rebuilt", &export_vars.innodb_read_views_rebuilt, SHOW_SIZE_T},
+  {"read_views_reused", &export_vars.innodb_read_views_reused, SHOW_SIZE_T},
   {"row_lock_current_waits", &export_vars.innodb_row_lock_current_waits,
    SHOW_SIZE_T},
   {"row_lock_time", &export_vars.innodb_row_lock_time, SHOW_LONGLONG},
   {"row_lock_time_avg", &export_vars.innodb_row_lock_time_avg, SHOW_SIZE_T},
   {"row_lock_time_max", &export_vars.innodb_row_lock_time_max, SHOW_SIZE_T},
   {"row_lock_waits", &export_vars.innodb_row_lock_waits, SHOW_SIZE_T},
+  {"row_prefetch_batches", &export_vars.innodb_row_prefetch_batches,
+   SHOW_SIZE_T},
+  {"row_prefetch_rows", &export_vars.innodb_row_prefetch_rows, SHOW_SIZE_T},
   {"rows_deleted", &export_vars.innodb_rows_deleted, SHOW_SIZE_T},
   {"rows_inserted", &export_vars.innodb_rows_inserted, SHOW_SIZE_T},
+  {"rows_bulk_loaded", &export_vars.innodb_rows_bulk_loaded, SHOW_SIZE_T},
   {"rows_read", &export_vars.innodb_rows_read, SHOW_SIZE_T},
   {"rows_updated", &export_vars.innodb_rows_updated, SHOW_SIZE_T},
   {"system_rows_deleted", &export_vars.innodb_system_rows_deleted,SHOW_SIZE_T},
@@ -1036,6 +1070,7 @@ static SHOW_VAR innodb_status_variables[]= {
   {"have_lzma", &innodb_have_lzma, SHOW_BOOL},
   {"have_bzip2", &innodb_have_bzip2, SHOW_BOOL},
   {"have_snappy", &innodb_have_snappy, SHOW_BOOL},
+  {"have_zstd", &innodb_have_zstd, SHOW_BOOL},
   {"have_punch_hole", &innodb_have_punch_hole, SHOW_BOOL},
 
   /* Defragmentation */
@@ -1073,6 +1108,10 @@ static SHOW_VAR innodb_status_variables[]= {
    &export_vars.innodb_encryption_rotation_pages_flushed, SHOW_SIZE_T},
   {"encryption_rotation_estimated_iops",
    &export_vars.innodb_encryption_rotation_estimated_iops, SHOW_SIZE_T},
+  {"encryption_rotation_pages_per_second",
+   &export_vars.innodb_encryption_rotation_pages_per_second, SHOW_SIZE_T},
+  {"encryption_rotation_allowed_iops",
+   &export_vars.innodb_encryption_rotation_allowed_iops, SHOW_SIZE_T},
   {"encryption_key_rotation_list_length",
    &export_vars.innodb_key_rotation_list_length, SHOW_LONGLONG},
   {"encryption_n_merge_blocks_encrypted",
@@ -1883,6 +1922,15 @@ const char *thd_innodb_tmpdir(THD *thd)
 	return(tmp_dir);
 }
 
+/** Get the value of innodb_ddl_threads.
+@param[in]	thd	thread handle, or NULL to query
+			the global innodb_ddl_threads.
+@return the maximum number of threads for merge-sorting index records */
+uint thd_ddl_threads(THD *thd)
+{
+	return(THDVAR(thd, ddl_threads));
+}
+
 /** Obtain the InnoDB transaction of a MySQL thread.
 @param[in,out]	thd	thread handle
 @return reference to transaction pointer */
@@ -3744,6 +3792,15 @@ static int innodb_init_params()
 	}
 #endif
 
+#ifndef HAVE_ZSTD
+	if (innodb_compression_algorithm == PAGE_ZSTD_ALGORITHM) {
+		sql_print_error("InnoDB: innodb_compression_algorithm = %lu unsupported.\n"
+				"InnoDB: libzstd is not installed. \n",
+				innodb_compression_algorithm);
+		DBUG_RETURN(HA_ERR_INITIALIZATION);
+	}
+#endif
+
 	if ((srv_encrypt_tables || srv_encrypt_log
 	     || innodb_encrypt_temporary_tables)
 	     && !encryption_key_id_exists(FIL_DEFAULT_ENCRYPTION_KEY)) {
@@ -6461,6 +6518,16 @@ innobase_fts_casedn_str(
 
 #define misc_word_char(X)       0
 
+/** Determine if an ASCII character is a true_word_char().
+In every ASCII based character set, the word characters in the range
+0..127 are exactly the letters, the digits and the underscore.
+@param c  character in the range 0..127
+@return whether c is a word character */
+static inline bool fts_ascii_word_char(byte c)
+{
+	return byte((c | 0x20) - 'a') < 26 || byte(c - '0') < 10 || c == '_';
+}
+
 /*************************************************************//**
 Get the next token from the given string and store it in *token.
 It is mostly copied from MyISAM's doc parsing function ft_simple_get_word()
@@ -6482,12 +6549,24 @@ innobase_mysql_fts_get_token(
 	token->f_n_char = token->f_len = 0;
 	token->f_str = NULL;
 
+	/* ASCII characters are classified inline, without invoking
+	the character set handler. Only other characters need it. */
+	const bool	ascii = my_charset_is_ascii_based(cs);
+
 	for (;;) {
 
 		if (doc >= end) {
 			return ulint(doc - start);
 		}
 
+		if (ascii && *doc < 0x80) {
+			if (fts_ascii_word_char(*doc)) {
+				break;
+			}
+			doc++;
+			continue;
+		}
+
 		int	ctype;
 
 		mbl = cs->ctype(&ctype, doc, (const uchar*) end);
@@ -6506,6 +6585,18 @@ innobase_mysql_fts_get_token(
 
 	while (doc < end) {
 
+		if (ascii && *doc < 0x80) {
+			if (!fts_ascii_word_char(*doc)) {
+				/* misc_word_char() does not hold
+				for any character. */
+				break;
+			}
+			mwc = 0;
+			++length;
+			++doc;
+			continue;
+		}
+
 		int	ctype;
 
 		mbl = cs->ctype(&ctype, (uchar*) doc, (uchar*) end);
@@ -9589,7 +9680,6 @@ ha_innobase::ft_init_ext(
 	const byte*	q = reinterpret_cast<const byte*>(
 		const_cast<char*>(query));
 
-	// FIXME: support ft_init_ext_with_hints(), pass LIMIT
 	dberr_t	error = fts_query(trx, index, flags, q, query_len, &result);
 
 	if (error != DB_SUCCESS) {
@@ -9605,6 +9695,7 @@ ha_innobase::ft_init_ext(
 	fts_hdl->could_you = const_cast<_ft_vft_ext*>(&ft_vft_ext_result);
 	fts_hdl->ft_prebuilt = m_prebuilt;
 	fts_hdl->ft_result = result;
+	fts_hdl->ft_limit = ULINT_UNDEFINED;
 
 	/* FIXME: Re-evaluate the condition when Bug 14469540 is resolved */
 	m_prebuilt->in_fts_query = true;
@@ -9612,6 +9703,27 @@ ha_innobase::ft_init_ext(
 	return(reinterpret_cast<FT_INFO*>(fts_hdl));
 }
 
+/** Initialize FT index scan of which at most limit rows will be read
+in rank order
+@param flags	FT_NL, FT_BOOL, FT_SORTED, FT_EXPAND
+@param keynr	index number
+@param key	search string
+@param limit	maximum number of rows to be read
+@return FT_INFO structure if successful or NULL */
+FT_INFO*
+ha_innobase::ft_init_ext_with_limit(uint flags, uint keynr, String* key,
+				    ha_rows limit)
+{
+	FT_INFO*	ft = ft_init_ext(flags, keynr, key);
+
+	if (ft && (flags & FT_SORTED)) {
+		reinterpret_cast<NEW_FT_INFO*>(ft)->ft_limit = ulint(
+			std::min<ha_rows>(limit, ULINT_UNDEFINED));
+	}
+
+	return(ft);
+}
+
 /*****************************************************************//**
 Set up search tuple for a query through FTS_DOC_ID_INDEX on
 supplied Doc ID. This is used by MySQL to retrieve the documents
@@ -9681,9 +9793,13 @@ ha_innobase::ft_read(
 		if (result->rankings_by_id != NULL) {
 			/* Now that we have the complete result, we
 			need to sort the document ids on their rank
-			calculation. */
+			calculation. If the number of rows to be read
+			is bounded, only the top ranked ones are
+			sorted for now. */
 
-			fts_query_sort_result_on_rank(result);
+			fts_query_sort_result_on_rank(
+				result, reinterpret_cast<NEW_FT_INFO*>(
+					ft_handler)->ft_limit);
 
 			result->current = const_cast<ib_rbt_node_t*>(
 				rbt_first(result->rankings_by_rank));
@@ -9691,8 +9807,7 @@ ha_innobase::ft_read(
 			ut_a(result->current == NULL);
 		}
 	} else {
-		result->current = const_cast<ib_rbt_node_t*>(
-			rbt_next(result->rankings_by_rank, result->current));
+		fts_query_next_on_rank(result);
 	}
 
 next_record:
@@ -9747,9 +9862,7 @@ ha_innobase::ft_read(
 			table->status = 0;
 			break;
 		case DB_RECORD_NOT_FOUND:
-			result->current = const_cast<ib_rbt_node_t*>(
-				rbt_next(result->rankings_by_rank,
-					 result->current));
+			fts_query_next_on_rank(result);
 
 			if (!result->current) {
 				/* exhaust the result set, should return
@@ -15398,7 +15511,11 @@ ha_innobase::extra(
 	case HA_EXTRA_INSERT_WITH_UPDATE:
 		trx->duplicates |= TRX_DUP_IGNORE;
 		goto stmt_boundary;
+	case HA_EXTRA_IGNORE_DUP_KEY:
+		m_prebuilt->ignore_dup_key = true;
+		break;
 	case HA_EXTRA_NO_IGNORE_DUP_KEY:
+		m_prebuilt->ignore_dup_key = false;
 		trx->duplicates &= ~TRX_DUP_IGNORE;
 		if (trx->is_bulk_insert()) {
 			/* Allow a subsequent INSERT into an empty table
@@ -15462,9 +15579,54 @@ ha_innobase::reset()
 	m_prebuilt->autoinc_last_value = 0;
 
 	m_prebuilt->skip_locked = false;
+	m_prebuilt->ignore_dup_key = false;
+	m_prebuilt->bulk_insert_buffer = false;
 	return(0);
 }
 
+/** Start a bulk insert. If the table is empty, the rows may be
+buffered until end_bulk_insert().
+@param rows   number of rows to be inserted, or 0 if unknown
+@param flags  flags */
+void ha_innobase::start_bulk_insert(ha_rows rows, uint flags)
+{
+	/* INSERT IGNORE must skip duplicate rows one by one, but
+	duplicates in buffered rows would only be detected at
+	end_bulk_insert(). */
+	m_prebuilt->bulk_insert_buffer = !m_prebuilt->ignore_dup_key
+		&& THDVAR(m_user_thd, bulk_insert_buffer);
+}
+
+/** End a bulk insert, and load any buffered rows into the table.
+@return 0 or error number */
+int ha_innobase::end_bulk_insert()
+{
+	if (!m_prebuilt->bulk_insert_buffer) {
+		return 0;
+	}
+
+	m_prebuilt->bulk_insert_buffer = false;
+
+	trx_t*	trx = m_prebuilt->trx;
+	dberr_t	err = trx->bulk_insert_apply(*m_prebuilt->table, table);
+
+	if (err == DB_SUCCESS) {
+		return 0;
+	}
+
+	/* The rows were covered by a TRX_UNDO_EMPTY record, like in
+	row_mysql_handle_errors(): MariaDB will roll back the entire
+	transaction. */
+	trx->bulk_insert = false;
+	trx->last_sql_stat_start.least_undo_no = 0;
+	trx->savepoints_discard();
+
+	int error = convert_error_code_to_mysql(
+		err, m_prebuilt->table->flags, m_user_thd);
+	set_my_errno(error);
+	return error;
+}
+
 /******************************************************************//**
 MySQL calls this function at the start of each SQL statement inside LOCK
 TABLES. Inside LOCK TABLES the ::external_lock method does not work to
@@ -18811,6 +18973,12 @@ static MYSQL_SYSVAR_ULONG(buffer_pool_dump_pct, srv_buf_pool_dump_pct,
   "Dump only the hottest N% of each buffer pool, defaults to 25",
   NULL, NULL, 25, 1, 100, 0);
 
+static MYSQL_SYSVAR_UINT(buffer_pool_dump_interval, srv_buf_pool_dump_interval,
+  PLUGIN_VAR_RQCMDARG,
+  "Dump the buffer pool every N seconds while the server is running;"
+  " 0 (the default) disables periodic dumps",
+  NULL, NULL, 0, 0, 86400, 0);
+
 #ifdef UNIV_DEBUG
 /* Added to test the innodb_buffer_pool_load_incomplete status variable. */
 static MYSQL_SYSVAR_ULONG(buffer_pool_load_pages_abort, srv_buf_pool_load_pages_abort,
@@ -19026,6 +19194,14 @@ static MYSQL_SYSVAR_ULONGLONG(log_file_size, srv_log_file_size,
   NULL, NULL, 96 << 20, 1 << 20, std::numeric_limits<ulonglong>::max(),
   UNIV_PAGE_SIZE_MAX);
 
+static MYSQL_SYSVAR_UINT(log_group_commit_delay, srv_log_group_commit_delay,
+  PLUGIN_VAR_OPCMDARG,
+  "Maximum time in microseconds that a redo log flush may wait for more"
+  " commits to join it, when they arrive faster than the log is flushed;"
+  " 0 (the default) disables the wait, and waits shorter than 100"
+  " microseconds are skipped",
+  NULL, NULL, 0, 0, 1000, 0);
+
 static MYSQL_SYSVAR_ULONG(log_write_ahead_size, srv_log_write_ahead_size,
   PLUGIN_VAR_RQCMDARG,
   "Redo log write ahead unit size to avoid read-on-write,"
@@ -19133,6 +19309,13 @@ static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Use NUMA interleave memory policy to allocate InnoDB buffer pool.",
   NULL, NULL, FALSE);
+
+static MYSQL_SYSVAR_BOOL(numa_local, srv_numa_local,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Bind each InnoDB buffer pool chunk to one NUMA node, and prefer"
+  " allocating buffer pool blocks on the node of the requesting thread."
+  " Ignored if innodb_numa_interleave is set.",
+  NULL, NULL, FALSE);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_ENUM(change_buffering, innodb_change_buffering,
@@ -19216,6 +19399,12 @@ static MYSQL_SYSVAR_BOOL(random_read_ahead, srv_random_read_ahead,
   "Whether to use read ahead for random access within an extent.",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(index_read_ahead, srv_index_read_ahead,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether index range scans read ahead the next leaf pages"
+  " found in the parent node pointer page.",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   PLUGIN_VAR_RQCMDARG,
   "Number of pages that must be accessed sequentially for InnoDB to"
@@ -19367,7 +19556,7 @@ static MYSQL_SYSVAR_BOOL(force_primary_key,
   "Do not allow creating a table without primary key (off by default)",
   NULL, NULL, FALSE);
 
-static const char *page_compression_algorithms[]= { "none", "zlib", "lz4", "lzo", "lzma", "bzip2", "snappy", 0 };
+static const char *page_compression_algorithms[]= { "none", "zlib", "lz4", "lzo", "lzma", "bzip2", "snappy", "zstd", 0 };
 static TYPELIB page_compression_algorithms_typelib=
 {
   array_elements(page_compression_algorithms) - 1, 0,
@@ -19375,7 +19564,7 @@ static TYPELIB page_compression_algorithms_typelib=
 };
 static MYSQL_SYSVAR_ENUM(compression_algorithm, innodb_compression_algorithm,
   PLUGIN_VAR_OPCMDARG,
-  "Compression algorithm used on page compression. One of: none, zlib, lz4, lzo, lzma, bzip2, or snappy",
+  "Compression algorithm used on page compression. One of: none, zlib, lz4, lzo, lzma, bzip2, snappy, or zstd",
   innodb_compression_algorithm_validate, NULL,
   /* We use here the largest number of supported compression method to
   enable all those methods that are available. Availability of compression
@@ -19455,6 +19644,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_dump_now),
   MYSQL_SYSVAR(buffer_pool_dump_at_shutdown),
   MYSQL_SYSVAR(buffer_pool_dump_pct),
+  MYSQL_SYSVAR(buffer_pool_dump_interval),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buffer_pool_evict),
 #endif /* UNIV_DEBUG */
@@ -19505,6 +19695,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(page_size),
   MYSQL_SYSVAR(log_buffer_size),
   MYSQL_SYSVAR(log_file_size),
+  MYSQL_SYSVAR(log_group_commit_delay),
   MYSQL_SYSVAR(log_write_ahead_size),
   MYSQL_SYSVAR(log_group_home_dir),
   MYSQL_SYSVAR(max_dirty_pages_pct),
@@ -19541,6 +19732,8 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(ddl_threads),
+  MYSQL_SYSVAR(bulk_insert_buffer),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -19552,6 +19745,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(use_native_aio),
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
+  MYSQL_SYSVAR(numa_local),
 #endif /* HAVE_LIBNUMA */
   MYSQL_SYSVAR(change_buffering),
   MYSQL_SYSVAR(change_buffer_max_size),
@@ -19563,6 +19757,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(disallow_writes),
 #endif /* WITH_INNODB_DISALLOW_WRITES */
   MYSQL_SYSVAR(random_read_ahead),
+  MYSQL_SYSVAR(index_read_ahead),
   MYSQL_SYSVAR(read_ahead_threshold),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
@@ -19671,7 +19866,9 @@ i_s_innodb_sys_foreign,
 i_s_innodb_sys_foreign_cols,
 i_s_innodb_sys_tablespaces,
 i_s_innodb_sys_virtual,
-i_s_innodb_tablespaces_encryption
+i_s_innodb_tablespaces_encryption,
+i_s_innodb_purge_tables,
+i_s_innodb_lock_wait_stats
 maria_declare_plugin_end;
 
 /** @brief Adjust some InnoDB startup parameters based on file contents
@@ -20761,6 +20958,17 @@ innodb_compression_algorithm_validate(
 		DBUG_RETURN(1);
 	}
 #endif
+
+#ifndef HAVE_ZSTD
+	if (compression_algorithm == PAGE_ZSTD_ALGORITHM) {
+		push_warning_printf(thd, Sql_condition::WARN_LEVEL_WARN,
+				    HA_ERR_UNSUPPORTED,
+				    "InnoDB: innodb_compression_algorithm = %lu unsupported.\n"
+				    "InnoDB: libzstd is not installed. \n",
+				    compression_algorithm);
+		DBUG_RETURN(1);
+	}
+#endif
 	DBUG_RETURN(0);
 }
 
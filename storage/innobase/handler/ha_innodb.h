@@ -162,6 +162,8 @@ class ha_innobase final : public handler
 	int ft_init() override;
 	void ft_end() override { rnd_end(); }
 	FT_INFO *ft_init_ext(uint flags, uint inx, String* key) override;
+	FT_INFO *ft_init_ext_with_limit(uint flags, uint inx, String* key,
+					ha_rows limit) override;
 	int ft_read(uchar* buf) override;
 
 	void position(const uchar *record) override;
@@ -178,6 +180,10 @@ class ha_innobase final : public handler
 
 	int reset() override;
 
+	void start_bulk_insert(ha_rows rows, uint flags) override;
+
+	int end_bulk_insert() override;
+
 	int external_lock(THD *thd, int lock_type) override;
 
 	int start_stmt(THD *thd, thr_lock_type lock_type) override;
@@ -577,6 +583,8 @@ typedef struct new_ft_info
 	struct _ft_vft_ext	*could_you;
 	row_prebuilt_t*		ft_prebuilt;
 	fts_result_t*		ft_result;
+	ulint			ft_limit;	/*!< maximum number of rows
+						to be read, or ULINT_UNDEFINED */
 } NEW_FT_INFO;
 
 /**
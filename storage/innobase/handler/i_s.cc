@@ -57,6 +57,8 @@ Created July 18, 2007 Vasil Dimov
 #include "fil0crypt.h"
 #include "dict0crea.h"
 #include "scope.h"
+#include "trx0purge.h"
+#include "lock0lock.h"
 
 /** The latest successfully looked up innodb_fts_aux_table */
 table_id_t innodb_ft_aux_table_id;
@@ -1588,6 +1590,11 @@ static ST_FIELD_INFO	i_s_cmpmem_fields_info[] =
   Column("relocation_ops",   SLonglong(), NOT_NULL, "Total Number of Relocations"),
   Column("relocation_time",      SLong(), NOT_NULL, "Total Duration of Relocations,"
                                                     " in Seconds"),
+  Column("memory_saved",     SLonglong(), NOT_NULL, "Bytes Saved by Not Keeping"
+                                                    " Uncompressed Pages,"
+                                                    " Including BLOB Pages"
+                                                    " That Are Never"
+                                                    " Uncompressed"),
   CEnd()
 };
 } // namespace Show
@@ -1648,7 +1655,12 @@ i_s_cmpmem_fill_low(
 		(*field++)->store(buddy_stat->used, true);
 		(*field++)->store(zip_free_len_local[x], true);
 		(*field++)->store(buddy_stat->relocated, true);
-		(*field)->store(buddy_stat->relocated_usec / 1000000, true);
+		(*field++)->store(buddy_stat->relocated_usec / 1000000, true);
+		/* Compressed BLOB pages (FIL_PAGE_TYPE_ZBLOB) are never
+		in unzip_LRU, so they are counted as saved too. */
+		(*field)->store(ulonglong(buddy_stat->used
+					  - buddy_stat->unzipped)
+				<< srv_page_size_shift, true);
 
 		if (schema_table_store_record(thd, table)) {
 			DBUG_RETURN(1);
@@ -3627,6 +3639,12 @@ static ST_FIELD_INFO	i_s_innodb_buffer_stats_fields_info[] =
 #define IDX_BUF_STATS_UNZIP_CUR		31
   Column("UNCOMPRESS_CURRENT", ULonglong(), NOT_NULL),
 
+#define IDX_BUF_STATS_NUMA_LOCAL	32
+  Column("NUMA_LOCAL_ALLOCATIONS", ULonglong(), NOT_NULL),
+
+#define IDX_BUF_STATS_NUMA_REMOTE	33
+  Column("NUMA_REMOTE_ALLOCATIONS", ULonglong(), NOT_NULL),
+
   CEnd()
 };
 } // namespace Show
@@ -3754,6 +3772,10 @@ static int i_s_innodb_stats_fill(THD *thd, TABLE_LIST * tables, Item *)
 
 	OK(fields[IDX_BUF_STATS_UNZIP_CUR]->store(info.unzip_cur, true));
 
+	OK(fields[IDX_BUF_STATS_NUMA_LOCAL]->store(info.numa_local, true));
+
+	OK(fields[IDX_BUF_STATS_NUMA_REMOTE]->store(info.numa_remote, true));
+
 	DBUG_RETURN(schema_table_store_record(thd, table));
 }
 
@@ -6903,3 +6925,431 @@ struct st_maria_plugin	i_s_innodb_tablespaces_encryption =
 	STRUCT_FLD(version_info, INNODB_VERSION_STR),
 	STRUCT_FLD(maturity, MariaDB_PLUGIN_MATURITY_STABLE)
 };
+
+namespace Show {
+/**  PURGE_TABLES    ******************************************************/
+/* Fields of the table INFORMATION_SCHEMA.INNODB_PURGE_TABLES */
+static ST_FIELD_INFO	innodb_purge_tables_fields_info[] =
+{
+#define PURGE_TABLES_TABLE_ID		0
+  Column("TABLE_ID", ULonglong(), NOT_NULL),
+
+#define PURGE_TABLES_DATABASE_NAME	1
+  Column("DATABASE_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define PURGE_TABLES_TABLE_NAME		2
+  Column("TABLE_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define PURGE_TABLES_UNDO_RECORDS	3
+  Column("UNDO_RECORDS", ULonglong(), NOT_NULL),
+
+#define PURGE_TABLES_PURGE_TASKS	4
+  Column("PURGE_TASKS", ULong(), NOT_NULL),
+
+#define PURGE_TABLES_TRX_NO		5
+  Column("TRX_NO", ULonglong(), NOT_NULL),
+
+#define PURGE_TABLES_TRX_LAG		6
+  Column("TRX_LAG", ULonglong(), NOT_NULL),
+
+  CEnd()
+};
+} // namespace Show
+
+/** A row of INFORMATION_SCHEMA.INNODB_PURGE_TABLES */
+struct i_s_purge_tables_row
+{
+	/** purge statistics of the table */
+	purge_sys_t::table_stats	stats;
+	/** whether the table was found in the data dictionary cache */
+	bool				found;
+	/** database name, if found */
+	char				db[MAX_DB_UTF8_LEN];
+	/** table name, if found */
+	char				table[MAX_TABLE_UTF8_LEN];
+};
+
+/** Populate INFORMATION_SCHEMA.INNODB_PURGE_TABLES with the tables
+whose undo log records were processed in the latest purge batch.
+@param[in]	thd	thread
+@param[in,out]	tables	tables to fill
+@return 0 on success */
+static int i_s_purge_tables_fill_table(THD *thd, TABLE_LIST *tables, Item *)
+{
+	DBUG_ENTER("i_s_purge_tables_fill_table");
+	RETURN_IF_INNODB_NOT_STARTED(tables->schema_table_name.str);
+
+	/* deny access to user without PROCESS_ACL privilege */
+	if (check_global_access(thd, PROCESS_ACL)) {
+		DBUG_RETURN(0);
+	}
+
+	/* Create a snapshot of the statistics so that we will not
+	block purge while holding dict_sys.mutex below. */
+	purge_sys.stats_mutex.wr_lock();
+	const std::vector<purge_sys_t::table_stats> snap(
+		purge_sys.batch_tables);
+	purge_sys.stats_mutex.wr_unlock();
+
+	/* Copy the rows, so that dict_sys.mutex will not be held
+	while the rows are being stored. */
+	std::vector<i_s_purge_tables_row>	rows(snap.size());
+
+	dict_sys.mutex_lock();
+
+	for (size_t i = 0; i < snap.size(); i++) {
+		i_s_purge_tables_row&	row = rows[i];
+		row.stats = snap[i];
+		const dict_table_t*	table = dict_sys.find_table(
+			row.stats.id);
+		row.found = table != nullptr;
+		if (table) {
+			dict_fs2utf8(table->name.m_name,
+				     row.db, sizeof row.db,
+				     row.table, sizeof row.table);
+		}
+	}
+
+	dict_sys.mutex_unlock();
+
+	const trx_id_t	max_trx_id = trx_sys.get_max_trx_id();
+	Field**		fields = tables->table->field;
+
+	for (const i_s_purge_tables_row& row : rows) {
+		const purge_sys_t::table_stats&	t = row.stats;
+
+		if (row.found) {
+			if (field_store_string(
+				    fields[PURGE_TABLES_DATABASE_NAME], row.db)
+			    || field_store_string(
+				    fields[PURGE_TABLES_TABLE_NAME],
+				    row.table)) {
+				DBUG_RETURN(1);
+			}
+		} else {
+			fields[PURGE_TABLES_DATABASE_NAME]->set_null();
+			fields[PURGE_TABLES_TABLE_NAME]->set_null();
+		}
+
+		if (fields[PURGE_TABLES_TABLE_ID]->store(t.id, true)
+		    || fields[PURGE_TABLES_UNDO_RECORDS]->store(
+			    t.n_recs, true)
+		    || fields[PURGE_TABLES_PURGE_TASKS]->store(
+			    t.n_tasks, true)
+		    || fields[PURGE_TABLES_TRX_NO]->store(t.trx_no, true)
+		    || fields[PURGE_TABLES_TRX_LAG]->store(
+			    max_trx_id > t.trx_no
+			    ? max_trx_id - t.trx_no : 0, true)
+		    || schema_table_store_record(thd, tables->table)) {
+			DBUG_RETURN(1);
+		}
+	}
+
+	DBUG_RETURN(0);
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_PURGE_TABLES
+@param[in,out]	p	table schema object
+@return 0 on success */
+static int innodb_purge_tables_init(void *p)
+{
+	ST_SCHEMA_TABLE*	schema;
+
+	DBUG_ENTER("innodb_purge_tables_init");
+
+	schema = (ST_SCHEMA_TABLE*) p;
+
+	schema->fields_info = Show::innodb_purge_tables_fields_info;
+	schema->fill_table = i_s_purge_tables_fill_table;
+
+	DBUG_RETURN(0);
+}
+
+struct st_maria_plugin	i_s_innodb_purge_tables =
+{
+	/* the plugin type (a MYSQL_XXX_PLUGIN value) */
+	/* int */
+	STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+	/* pointer to type-specific plugin descriptor */
+	/* void* */
+	STRUCT_FLD(info, &i_s_info),
+
+	/* plugin name */
+	/* const char* */
+	STRUCT_FLD(name, "INNODB_PURGE_TABLES"),
+
+	/* plugin author (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(author, plugin_author),
+
+	/* general descriptive text (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(descr, "InnoDB tables in the latest purge batch"),
+
+	/* the plugin license (PLUGIN_LICENSE_XXX) */
+	/* int */
+	STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+	/* the function to invoke when plugin is loaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(init, innodb_purge_tables_init),
+
+	/* the function to invoke when plugin is unloaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(deinit, i_s_common_deinit),
+
+	/* plugin version (for SHOW PLUGINS) */
+	/* unsigned int */
+	STRUCT_FLD(version, INNODB_VERSION_SHORT),
+
+	/* struct st_mysql_show_var* */
+	STRUCT_FLD(status_vars, NULL),
+
+	/* struct st_mysql_sys_var** */
+	STRUCT_FLD(system_vars, NULL),
+
+	/* Maria extension */
+	STRUCT_FLD(version_info, INNODB_VERSION_STR),
+	STRUCT_FLD(maturity, MariaDB_PLUGIN_MATURITY_STABLE)
+};
+
+namespace Show {
+/**  LOCK_WAIT_STATS    ***************************************************/
+/* Fields of the table INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS */
+static ST_FIELD_INFO	innodb_lock_wait_stats_fields_info[] =
+{
+#define LOCK_WAIT_STATS_TABLE_ID	0
+  Column("TABLE_ID", ULonglong(), NOT_NULL),
+
+#define LOCK_WAIT_STATS_INDEX_ID	1
+  Column("INDEX_ID", ULonglong(), NULLABLE),
+
+#define LOCK_WAIT_STATS_DATABASE_NAME	2
+  Column("DATABASE_NAME", Varchar(NAME_CHAR_LEN), NOT_NULL),
+
+#define LOCK_WAIT_STATS_TABLE_NAME	3
+  Column("TABLE_NAME", Varchar(NAME_CHAR_LEN), NOT_NULL),
+
+#define LOCK_WAIT_STATS_INDEX_NAME	4
+  Column("INDEX_NAME", Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define LOCK_WAIT_STATS_LOCK_WAITS	5
+  Column("LOCK_WAITS", ULonglong(), NOT_NULL),
+
+#define LOCK_WAIT_STATS_LOCK_WAIT_TIME	6
+  Column("LOCK_WAIT_TIME", ULonglong(), NOT_NULL),
+
+#define LOCK_WAIT_STATS_LOCK_WAIT_TIME_MAX 7
+  Column("LOCK_WAIT_TIME_MAX", ULonglong(), NOT_NULL),
+
+  CEnd()
+};
+} // namespace Show
+
+/** A row of INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS */
+struct i_s_lock_wait_stats_row
+{
+	/** table identifier */
+	table_id_t		table_id;
+	/** index identifier, or 0 for table lock waits */
+	index_id_t		index_id;
+	/** database name */
+	char			db[MAX_DB_UTF8_LEN];
+	/** table name */
+	char			table[MAX_TABLE_UTF8_LEN];
+	/** index name, if index_id != 0 */
+	char			index[NAME_LEN + 1];
+	/** lock wait statistics */
+	lock_wait_stats_t	stats;
+};
+
+/** Copy a row of INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS.
+@param[in,out]	rows	rows that were collected
+@param[in]	table	table
+@param[in]	index	index, or nullptr for table lock waits
+@param[in]	stats	lock wait statistics */
+static void i_s_lock_wait_stats_collect(
+	std::vector<i_s_lock_wait_stats_row>& rows,
+	const dict_table_t* table, const dict_index_t* index,
+	const lock_wait_stats_t& stats)
+{
+	rows.emplace_back();
+	i_s_lock_wait_stats_row&	row = rows.back();
+
+	row.table_id = table->id;
+	row.index_id = index ? index->id : 0;
+	dict_fs2utf8(table->name.m_name, row.db, sizeof row.db,
+		     row.table, sizeof row.table);
+	if (index) {
+		snprintf(row.index, sizeof row.index, "%s",
+			 static_cast<const char*>(index->name));
+	}
+	row.stats = stats;
+}
+
+/** Store a row of INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS.
+@param[in]	thd		thread
+@param[in,out]	tables		tables to fill
+@param[in]	row		row to store
+@return 0 on success */
+static int i_s_lock_wait_stats_store(THD *thd, TABLE_LIST *tables,
+				     const i_s_lock_wait_stats_row &row)
+{
+	Field**	fields = tables->table->field;
+
+	if (row.index_id) {
+		fields[LOCK_WAIT_STATS_INDEX_ID]->set_notnull();
+		fields[LOCK_WAIT_STATS_INDEX_NAME]->set_notnull();
+		if (fields[LOCK_WAIT_STATS_INDEX_ID]->store(row.index_id, true)
+		    || field_store_string(fields[LOCK_WAIT_STATS_INDEX_NAME],
+					  row.index)) {
+			return 1;
+		}
+	} else {
+		fields[LOCK_WAIT_STATS_INDEX_ID]->set_null();
+		fields[LOCK_WAIT_STATS_INDEX_NAME]->set_null();
+	}
+
+	return fields[LOCK_WAIT_STATS_TABLE_ID]->store(row.table_id, true)
+		|| field_store_string(fields[LOCK_WAIT_STATS_DATABASE_NAME],
+				      row.db)
+		|| field_store_string(fields[LOCK_WAIT_STATS_TABLE_NAME],
+				      row.table)
+		|| fields[LOCK_WAIT_STATS_LOCK_WAITS]->store(
+			row.stats.n_waits, true)
+		|| fields[LOCK_WAIT_STATS_LOCK_WAIT_TIME]->store(
+			row.stats.wait_time, true)
+		|| fields[LOCK_WAIT_STATS_LOCK_WAIT_TIME_MAX]->store(
+			row.stats.wait_time_max, true)
+		|| schema_table_store_record(thd, tables->table);
+}
+
+/** Populate INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS with the lock waits
+of the tables and indexes in the data dictionary cache.
+@param[in]	thd	thread
+@param[in,out]	tables	tables to fill
+@return 0 on success */
+static int i_s_lock_wait_stats_fill_table(THD *thd, TABLE_LIST *tables,
+					  Item *)
+{
+	DBUG_ENTER("i_s_lock_wait_stats_fill_table");
+	RETURN_IF_INNODB_NOT_STARTED(tables->schema_table_name.str);
+
+	/* deny access to user without PROCESS_ACL privilege */
+	if (check_global_access(thd, PROCESS_ACL)) {
+		DBUG_RETURN(0);
+	}
+
+	/* Copy the rows, so that dict_sys.mutex will not be held
+	while the rows are being stored. */
+	std::vector<i_s_lock_wait_stats_row>	rows;
+
+	dict_sys.mutex_lock();
+
+	for (const dict_table_t* table = UT_LIST_GET_FIRST(dict_sys.table_LRU),
+		     *next_list = UT_LIST_GET_FIRST(dict_sys.table_non_LRU);
+	     table; ) {
+		const lock_wait_stats_t	stats = table->lock_waits;
+
+		if (stats.n_waits) {
+			i_s_lock_wait_stats_collect(rows, table, nullptr,
+						    stats);
+		}
+
+		for (const dict_index_t* index
+			     = dict_table_get_first_index(table);
+		     index; index = dict_table_get_next_index(index)) {
+			const lock_wait_stats_t	stats = index->lock_waits;
+
+			if (stats.n_waits) {
+				i_s_lock_wait_stats_collect(rows, table,
+							    index, stats);
+			}
+		}
+
+		table = UT_LIST_GET_NEXT(table_LRU, table);
+		if (!table) {
+			table = next_list;
+			next_list = nullptr;
+		}
+	}
+
+	dict_sys.mutex_unlock();
+
+	int	err = 0;
+
+	for (const i_s_lock_wait_stats_row& row : rows) {
+		if ((err = i_s_lock_wait_stats_store(thd, tables, row))) {
+			break;
+		}
+	}
+
+	DBUG_RETURN(err);
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS
+@param[in,out]	p	table schema object
+@return 0 on success */
+static int innodb_lock_wait_stats_init(void *p)
+{
+	ST_SCHEMA_TABLE*	schema;
+
+	DBUG_ENTER("innodb_lock_wait_stats_init");
+
+	schema = (ST_SCHEMA_TABLE*) p;
+
+	schema->fields_info = Show::innodb_lock_wait_stats_fields_info;
+	schema->fill_table = i_s_lock_wait_stats_fill_table;
+
+	DBUG_RETURN(0);
+}
+
+struct st_maria_plugin	i_s_innodb_lock_wait_stats =
+{
+	/* the plugin type (a MYSQL_XXX_PLUGIN value) */
+	/* int */
+	STRUCT_FLD(type, MYSQL_INFORMATION_SCHEMA_PLUGIN),
+
+	/* pointer to type-specific plugin descriptor */
+	/* void* */
+	STRUCT_FLD(info, &i_s_info),
+
+	/* plugin name */
+	/* const char* */
+	STRUCT_FLD(name, "INNODB_LOCK_WAIT_STATS"),
+
+	/* plugin author (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(author, plugin_author),
+
+	/* general descriptive text (for SHOW PLUGINS) */
+	/* const char* */
+	STRUCT_FLD(descr, "InnoDB lock waits by table and index"),
+
+	/* the plugin license (PLUGIN_LICENSE_XXX) */
+	/* int */
+	STRUCT_FLD(license, PLUGIN_LICENSE_GPL),
+
+	/* the function to invoke when plugin is loaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(init, innodb_lock_wait_stats_init),
+
+	/* the function to invoke when plugin is unloaded */
+	/* int (*)(void*); */
+	STRUCT_FLD(deinit, i_s_common_deinit),
+
+	/* plugin version (for SHOW PLUGINS) */
+	/* unsigned int */
+	STRUCT_FLD(version, INNODB_VERSION_SHORT),
+
+	/* struct st_mysql_show_var* */
+	STRUCT_FLD(status_vars, NULL),
+
+	/* struct st_mysql_sys_var** */
+	STRUCT_FLD(system_vars, NULL),
+
+	/* Maria extension */
+	STRUCT_FLD(version_info, INNODB_VERSION_STR),
+	STRUCT_FLD(maturity, MariaDB_PLUGIN_MATURITY_STABLE)
+};
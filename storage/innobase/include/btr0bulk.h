@@ -288,11 +288,45 @@ class BtrBulk
 		const trx_t*	trx)
 		:
 		m_index(index),
-		m_trx(trx)
+		m_trx(trx),
+		m_node_ptr_heap(NULL),
+		m_first_leaf(FIL_NULL),
+		m_last_leaf(FIL_NULL)
 	{
 		ut_ad(!dict_index_is_spatial(index));
 	}
 
+	/** Constructor for loading a part of the leaf level only.
+	Several such objects may fill the same index concurrently, each
+	from a disjoint, ordered range of the sorted input. The node
+	pointers to the leaf pages are collected, and the upper levels
+	of the tree are built by stitch().
+	@param[in]	index		B-tree index
+	@param[in]	trx		transaction
+	@param[in]	leaf_only	must be true */
+	BtrBulk(
+		dict_index_t*	index,
+		const trx_t*	trx,
+		bool		leaf_only)
+		:
+		m_index(index),
+		m_trx(trx),
+		m_node_ptr_heap(mem_heap_create(1024)),
+		m_first_leaf(FIL_NULL),
+		m_last_leaf(FIL_NULL)
+	{
+		ut_ad(leaf_only);
+		ut_ad(!dict_index_is_spatial(index));
+	}
+
+	/** Destructor */
+	~BtrBulk()
+	{
+		if (m_node_ptr_heap) {
+			mem_heap_free(m_node_ptr_heap);
+		}
+	}
+
 	/** Insert a tuple
 	@param[in]	tuple	tuple to insert.
 	@return error code */
@@ -308,6 +342,14 @@ class BtrBulk
 	@return error code  */
 	dberr_t finish(dberr_t	err);
 
+	/** Link the leaf pages that were loaded by leaf-only BtrBulk
+	objects, and build the non-leaf levels of the tree from their
+	node pointers. The caller must invoke finish() afterwards.
+	@param[in]	parts	finished leaf-only loads, in key order
+	@param[in]	n	number of elements in parts
+	@return error code */
+	dberr_t stitch(BtrBulk* const* parts, ulint n);
+
 	/** Release all latches */
 	void release();
 
@@ -364,8 +406,22 @@ class BtrBulk
 	/** Root page level */
 	ulint			m_root_level;
 
-	/** Page cursor vector for all level */
+	/** Page cursor vector for all level; in stitch(), the
+	leaf level is NULL */
 	page_bulk_vector	m_page_bulks;
+
+	/** Memory heap for m_node_ptrs, or NULL if the upper levels
+	of the tree are being built by this object */
+	mem_heap_t*		m_node_ptr_heap;
+
+	/** Node pointers to the committed leaf pages of a leaf-only load */
+	std::vector<dtuple_t*, ut_allocator<dtuple_t*> >	m_node_ptrs;
+
+	/** First leaf page of a leaf-only load, or FIL_NULL */
+	uint32_t		m_first_leaf;
+
+	/** Last leaf page of a leaf-only load, or FIL_NULL */
+	uint32_t		m_last_leaf;
 };
 
 #endif
@@ -355,6 +355,10 @@ extern ulint	btr_search_n_succ;
 extern ulint	btr_search_n_hash_fail;
 #endif /* UNIV_SEARCH_PERF_STAT */
 
+/** Number of adaptive hash index lookups that found a record but
+fell back to a B-tree search because the page latch was not available */
+extern ib_counter_t<ulint, ib_counter_element_t>	btr_search_n_latch_fail;
+
 /** After change in n_fields or n_bytes in info, this many rounds are waited
 before starting the hash analysis again: this is to save CPU time when there
 is no hope in building a hash index. */
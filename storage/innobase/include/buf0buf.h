@@ -156,6 +156,8 @@ struct buf_pool_info_t
 	ulint	unzip_cur;		/*!< buf_LRU_stat_cur.unzip, num
 					pages decompressed in current
 					interval */
+	ulint	numa_local;		/*!< buf_pool.stat.n_numa_local */
+	ulint	numa_remote;		/*!< buf_pool.stat.n_numa_remote */
 };
 #endif /* !UNIV_INNOCHECKSUM */
 
@@ -428,12 +430,15 @@ bool buf_is_zeroes(st_::span<const byte> buf);
 @param[in]	check_lsn	whether the LSN should be checked
 @param[in]	read_buf	database page
 @param[in]	fsp_flags	tablespace flags
+@param[in]	page_crc32	checksum computed by buf_calc_pages_full_crc32(),
+				or nullptr
 @return whether the page is corrupted */
 bool
 buf_page_is_corrupted(
 	bool			check_lsn,
 	const byte*		read_buf,
-	ulint			fsp_flags)
+	ulint			fsp_flags,
+	const uint32_t*		page_crc32 = nullptr)
 	MY_ATTRIBUTE((warn_unused_result));
 
 inline void *aligned_malloc(size_t size, size_t align)
@@ -974,6 +979,10 @@ struct buf_block_t{
 					srv_page_size */
   /** read-write lock covering frame */
   block_lock lock;
+#ifdef HAVE_LIBNUMA
+  /** NUMA node of frame, if innodb_numa_local */
+  uint8_t numa_node;
+#endif
 #ifdef UNIV_DEBUG
   /** whether page.list is in buf_pool.withdraw
   ((state() == BUF_BLOCK_NOT_USED)) and the buffer pool is being shrunk;
@@ -1281,12 +1290,21 @@ struct buf_pool_stat_t{
 	ulint	LRU_waits;
 	ulint	LRU_bytes;	/*!< LRU size in bytes */
 	ulint	flush_list_bytes;/*!< flush_list size in bytes */
+	/** number of blocks allocated from buf_pool.free on the NUMA node
+	of the requesting thread; protected by buf_pool.mutex */
+	ulint	n_numa_local;
+	/** number of blocks allocated from buf_pool.free on another
+	NUMA node; protected by buf_pool.mutex */
+	ulint	n_numa_remote;
 };
 
 /** Statistics of buddy blocks of a given size. */
 struct buf_buddy_stat_t {
 	/** Number of blocks allocated from the buddy system. */
 	ulint		used;
+	/** Number of those blocks whose page also has an uncompressed
+	frame, that is, is in buf_pool.unzip_LRU. */
+	ulint		unzipped;
 	/** Number of blocks relocated by the buddy system. */
 	ib_uint64_t	relocated;
 	/** Total duration of block relocations, in microseconds. */
@@ -1307,6 +1325,10 @@ class buf_pool_t
     ut_new_pfx_t mem_pfx;
     /** array of buffer control blocks */
     buf_block_t *blocks;
+#ifdef HAVE_LIBNUMA
+    /** NUMA node that mem is bound to, if innodb_numa_local */
+    unsigned numa_node;
+#endif
 
     /** Map of first page frame address to chunks[] */
     using map= std::map<const void*, chunk_t*, std::less<const void*>,
@@ -35,6 +35,13 @@ architectures.
 @return	CRC-32C */
 uint32_t buf_calc_page_crc32(const byte* page);
 
+/** Calculate the innodb_checksum_algorithm=full_crc32 checksums of
+adjacent uncompressed pages, interleaving the computation where possible.
+@param[in]	pages	n pages of srv_page_size bytes each
+@param[in]	n	number of pages
+@param[out]	crc32	the checksum of each page */
+void buf_calc_pages_full_crc32(const byte* pages, size_t n, uint32_t* crc32);
+
 #ifndef UNIV_INNOCHECKSUM
 /** Calculate a checksum which is stored to the page when it is written
 to a file. Note that we must be careful to calculate the same value on
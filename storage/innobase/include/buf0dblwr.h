@@ -51,6 +51,11 @@ class buf_dblwr_t
     byte* write_buf;
     /** buffer blocks to be written via write_buf */
     element* buf_block_arr;
+    /** the doublewrite blocks that the batch is written to:
+    1 for block1, 2 for block2, 3 for both */
+    unsigned blocks;
+    /** whether a batch is being written from this slot */
+    bool running;
   };
 
   /** the page number of the first doublewrite block (block_size() pages) */
@@ -60,11 +65,14 @@ class buf_dblwr_t
 
   /** mutex protecting the data members below */
   mysql_mutex_t mutex;
-  /** condition variable for !batch_running */
+  /** condition variable for slot::running and writing */
   pthread_cond_t cond;
-  /** whether a batch is being written from the doublewrite buffer */
-  bool batch_running;
-  /** number of expected flush_buffered_writes_completed() calls */
+  /** the slot whose doublewrite block is being written, or nullptr.
+  At most one batch is being written to its doublewrite block at a time,
+  but while its data pages are being written, the other slot may
+  already be written to the other doublewrite block. */
+  slot *writing;
+  /** number of pending doublewrite block writes of the batch of writing */
   unsigned flushing_buffered_writes;
   /** pages submitted to flush_buffered_writes() */
   ulint pages_submitted;
@@ -83,6 +91,16 @@ class buf_dblwr_t
   /** Flush possible buffered writes to persistent storage. */
   bool flush_buffered_writes(const ulint size);
 
+  /** @return the number of pages that fit in the batch of active_slot:
+  both doublewrite blocks, or only one while the batch of the other slot
+  is still running */
+  ulint batch_size() const
+  {
+    mysql_mutex_assert_owner(&mutex);
+    const ulint size= block_size();
+    return slots[active_slot == &slots[0]].running ? size : 2 * size;
+  }
+
 public:
   /** Create or restore the doublewrite buffer in the TRX_SYS page.
   @return whether the operation succeeded */
@@ -117,8 +135,9 @@ class buf_dblwr_t
   /** Process and remove the double write buffer pages for all tablespaces. */
   void recover();
 
-  /** Update the doublewrite buffer on data page write completion. */
-  void write_completed();
+  /** Update the doublewrite buffer on data page write completion.
+  @param bpage  the page whose write was completed */
+  void write_completed(const buf_page_t &bpage);
   /** Flush possible buffered writes to persistent storage.
   It is very important to call this function after a batch of writes has been
   posted, and also when we may have to wait for a page latch!
@@ -159,7 +178,7 @@ class buf_dblwr_t
     if (is_initialised())
     {
       mysql_mutex_lock(&mutex);
-      while (batch_running)
+      while (slots[0].running || slots[1].running)
         my_cond_wait(&cond, &mutex.m_mutex);
       mysql_mutex_unlock(&mutex);
     }
@@ -32,6 +32,10 @@ void buf_dump_start();
 /** Start the buffer pool dump/load task and instructs it to start a load. */
 void buf_load_start();
 
+/** Start a buffer pool dump if innodb_buffer_pool_dump_interval seconds
+have passed since the previous dump was started. */
+void buf_dump_if_due();
+
 /** Abort a currently running buffer pool load. */
 void buf_load_abort();
 
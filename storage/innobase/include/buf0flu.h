@@ -33,6 +33,9 @@ Created 11/5/1995 Heikki Tuuri
 
 /** Number of pages flushed. Protected by buf_pool.mutex. */
 extern ulint buf_flush_page_count;
+/** Number of buf_flush_list() pages whose writes were initiated by
+worker tasks. */
+extern ulint buf_flush_parallel_page_count;
 /** Number of pages flushed via LRU. Protected by buf_pool.mutex.
 Also included in buf_flush_page_count. */
 extern ulint buf_lru_flush_page_count;
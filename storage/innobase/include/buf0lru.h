@@ -59,9 +59,14 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 @return true if found and freed */
 bool buf_LRU_scan_and_free_block(ulint limit= ULINT_UNDEFINED);
 
-/** @return a buffer block from the buf_pool.free list
+/** @return the NUMA node of the current thread
+@retval	-1	if innodb_numa_local is not in effect or the node is unknown */
+int buf_LRU_numa_node();
+
+/** @param numa_node	NUMA node of the current thread, or -1 for any
+@return a buffer block from the buf_pool.free list
 @retval	NULL	if the free list is empty */
-buf_block_t* buf_LRU_get_free_only();
+buf_block_t* buf_LRU_get_free_only(int numa_node= -1);
 
 /** Get a block from the buf_pool.free list.
 If the list is empty, blocks will be moved from the end of buf_pool.LRU
@@ -85,8 +90,11 @@ we put it to free list to be used.
   * scan LRU list even if buf_pool.try_LRU_scan is not set
 
 @param have_mutex  whether buf_pool.mutex is already being held
+@param numa_node   NUMA node of the current thread, or -1 for any;
+a caller that holds buf_pool.mutex must look it up before acquiring it
 @return the free control block, in state BUF_BLOCK_MEMORY */
-buf_block_t* buf_LRU_get_free_block(bool have_mutex)
+buf_block_t* buf_LRU_get_free_block(bool have_mutex,
+				    int numa_node= buf_LRU_numa_node())
 	MY_ATTRIBUTE((malloc,warn_unused_result));
 
 /** @return whether the unzip_LRU list should be used for evicting a victim
@@ -184,6 +192,8 @@ struct buf_LRU_stat_t
 {
 	ulint	io;	/**< Counter of buffer pool I/O operations. */
 	ulint	unzip;	/**< Counter of page_zip_decompress operations. */
+	ulint	unzip_us;/**< Time spent in page_zip_decompress,
+			in microseconds */
 };
 
 /** Current operation counters.  Not protected by any mutex.
@@ -200,5 +210,8 @@ Increments the I/O counter in buf_LRU_stat_cur. */
 /********************************************************************//**
 Increments the page_zip_decompress() counter in buf_LRU_stat_cur. */
 #define buf_LRU_stat_inc_unzip() buf_LRU_stat_cur.unzip++
+/********************************************************************//**
+Adds to the page_zip_decompress() time in buf_LRU_stat_cur. */
+#define buf_LRU_stat_add_unzip_us(us) buf_LRU_stat_cur.unzip_us += (us)
 
 #endif
@@ -29,6 +29,19 @@ Created 11/5/1995 Heikki Tuuri
 
 #include "buf0buf.h"
 
+/** Counters of the synchronous page reads of a thread */
+struct buf_read_stats_t
+{
+  /** number of pages read */
+  Atomic_counter<ulint> n_reads;
+  /** time spent waiting for the reads, in microseconds */
+  Atomic_counter<ulint> read_us;
+};
+
+/** If not null, buf_read_page() adds the page reads of the current
+thread to these counters, in addition to srv_stats */
+extern thread_local buf_read_stats_t *buf_read_stats;
+
 /** High-level function which reads a page asynchronously from a file to the
 buffer buf_pool if it is not already there. Sets the io_fix flag and sets
 an exclusive lock on the buffer frame. The flag is cleared and the x-lock
@@ -73,6 +86,17 @@ get read even if we return a positive value! */
 ulint
 buf_read_ahead_random(const page_id_t page_id, ulint zip_size, bool ibuf);
 
+/** Issue asynchronous reads for known pages of a tablespace, such as the
+leaf pages that an index range scan is about to reach (innodb_index_read_ahead).
+Pages that already reside in the buffer pool are skipped.
+The calling thread must not hold any page latches.
+@param[in]	space_id	tablespace identifier
+@param[in,out]	pages		page numbers; on return, the first pages
+				are those for which a read was issued
+@param[in]	n		number of elements in pages[]
+@return number of page read requests issued */
+ulint buf_read_ahead_pages(ulint space_id, uint32_t *pages, ulint n);
+
 /** Applies linear read-ahead if in the buf_pool the page is a border page of
 a linear read-ahead area and all the pages in the area have been accessed.
 Does not read any page if the read-ahead mechanism is not activated. Note
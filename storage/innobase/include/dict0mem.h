@@ -1113,6 +1113,8 @@ struct dict_index_t {
 				/* in which slot the next sample should be
 				saved. */
 	/* @} */
+	/** waits for record locks in this index */
+	lock_wait_stats_t lock_waits;
 private:
   /** R-tree split sequence number */
   Atomic_relaxed<node_seq_t> rtr_ssn;
@@ -2353,6 +2355,9 @@ struct dict_table_t {
   @see trx_lock_t::trx_locks */
   Atomic_counter<uint32_t> n_rec_locks;
 
+  /** waits for table locks on this table */
+  lock_wait_stats_t lock_waits;
+
 private:
   /** Count of how many handles are opened to this table. Dropping of the
   table is NOT allowed until this count gets to zero. MySQL does NOT
@@ -220,6 +220,10 @@ struct fil_crypt_stat_t
   ulint pages_modified= 0;
   ulint pages_flushed= 0;
   ulint estimated_iops= 0;
+  /** pages rotated per second during the latest second of rotation */
+  ulint pages_per_second= 0;
+  /** IOPS that key rotation may currently use */
+  ulint allowed_iops= 0;
 };
 
 /** Init space crypt */
@@ -281,6 +281,12 @@ struct fts_result_t {
 					indexed by doc id */
 	ib_rbt_t*	rankings_by_rank;/*!< RB tree of type fts_ranking_t
 					indexed by rank */
+	bool		partially_ranked;/*!< whether rankings_by_rank only
+					contains the top ranked documents
+					up to and including rank_bound */
+	fts_ranking_t	rank_bound;	/*!< the lowest ranked document
+					in rankings_by_rank, if
+					partially_ranked */
 };
 
 /** This is used to generate the FTS auxiliary table name, we need the
@@ -561,13 +567,17 @@ fts_retrieve_ranking(
 	doc_id_t	doc_id);		/*!< in: the interested document
 						doc_id */
 
-/******************************************************************//**
-FTS Query sort result, returned by fts_query() on fts_ranking_t::rank. */
-void
-fts_query_sort_result_on_rank(
-/*==========================*/
-	fts_result_t*	result);		/*!< out: result instance
-						to sort.*/
+/** Sort the result returned by fts_query() on fts_ranking_t::rank.
+@param[in,out]	result	result of fts_query()
+@param[in]	limit	number of top ranked documents to sort, or
+			ULINT_UNDEFINED to sort all of them */
+void fts_query_sort_result_on_rank(fts_result_t* result, ulint limit);
+
+/** Advance fts_result_t::current to the next document in rank order.
+If only the top ranked documents were sorted and all of them have been
+visited, the remaining documents will be sorted.
+@param[in,out]	result	result of fts_query() */
+void fts_query_next_on_rank(fts_result_t* result);
 
 /******************************************************************//**
 FTS Query free result, returned by fts_query(). */
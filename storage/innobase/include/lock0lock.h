@@ -260,6 +260,18 @@ lock_clust_rec_modify_check_and_lock(
 	const rec_offs*		offsets,/*!< in: rec_get_offsets(rec, index) */
 	que_thr_t*		thr)	/*!< in: query thread */
 	MY_ATTRIBUTE((warn_unused_result));
+
+/** Release an explicit LOCK_X|LOCK_REC_NOT_GAP on a clustered index record
+that the transaction has just modified, unless other transactions are
+waiting for the record. The record will remain implicitly locked by
+DB_TRX_ID=trx.id, and lock_rec_convert_impl_to_expl() will create an
+explicit lock on demand.
+@param block  buffer block of rec, latched by the caller
+@param rec    clustered index record
+@param trx    transaction that modified rec */
+void lock_clust_rec_release_to_impl(const buf_block_t &block,
+                                    const rec_t *rec, trx_t *trx);
+
 /*********************************************************************//**
 Checks if locks of other transactions prevent an immediate modify
 (delete mark or delete unmark) of a secondary index record.
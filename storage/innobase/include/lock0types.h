@@ -27,6 +27,7 @@ Created 5/7/1996 Heikki Tuuri
 #include "dict0types.h"
 #include "buf0types.h"
 #include "ut0lst.h"
+#include "my_atomic_wrapper.h"
 
 #ifndef lock0types_h
 #define lock0types_h
@@ -217,4 +218,27 @@ struct ib_lock_t
 
 typedef UT_LIST_BASE_NODE_T(ib_lock_t) trx_lock_list_t;
 
+/** Lock wait statistics of a table or an index, for
+INFORMATION_SCHEMA.INNODB_LOCK_WAIT_STATS. Modified while holding
+lock_sys.wait_mutex; may be read without it. */
+struct lock_wait_stats_t
+{
+  /** number of completed lock waits */
+  Atomic_relaxed<ulint> n_waits;
+  /** cumulative lock wait time, in milliseconds */
+  Atomic_relaxed<ulint> wait_time;
+  /** maximum lock wait time, in milliseconds */
+  Atomic_relaxed<ulint> wait_time_max;
+
+  /** Note that a lock wait completed.
+  @param ms  duration of the wait, in milliseconds */
+  void add(ulint ms)
+  {
+    n_waits= n_waits + 1;
+    wait_time= wait_time + ms;
+    if (ms > wait_time_max)
+      wait_time_max= ms;
+  }
+};
+
 #endif /* lock0types_h */
@@ -113,6 +113,11 @@ struct completion_callback;
 void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key = false,
   const completion_callback* cb=nullptr);
 
+/** Get the group commit statistics of log_write_up_to(flush_to_disk=true).
+@param[out]	requests	number of requests for flushing the log
+@param[out]	batches		number of log flushes that were initiated */
+void log_flush_batch_stats(size_t *requests, size_t *batches);
+
 /** write to the log file up to the last log entry.
 @param[in]	sync	whether we want the written log
 also to be flushed to disk. */
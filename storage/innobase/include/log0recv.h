@@ -33,6 +33,7 @@ Created 9/20/1997 Heikki Tuuri
 
 #include <deque>
 #include <map>
+#include <tpool.h>
 
 /** @return whether recovery is currently running. */
 #define recv_recovery_is_on() UNIV_UNLIKELY(recv_sys.recovery_on)
@@ -252,6 +253,8 @@ struct recv_sys_t
 				record, or 0 if none was parsed */
 	/** the time when progress was last reported */
 	time_t		progress_time;
+	/** the number of pages to recover when progress was last reported */
+	ulint		progress_pages;
 
   using map = std::map<const page_id_t, page_recv_t,
                        std::less<const page_id_t>,
@@ -282,7 +285,18 @@ struct recv_sys_t
   /** Last added LSN to pages. */
   lsn_t last_stored_lsn= 0;
 
+  /** Read redo log, possibly from the buffer of read_ahead().
+  @param offset  byte offset from the start of the first log file
+  @param buf     buffer to read into */
   void read(os_offset_t offset, span<byte> buf);
+  /** Start reading redo log in the background, so that a subsequent
+  read() of the same range can be served while the previously read
+  log is being parsed.
+  @param offset  byte offset from the start of the first log file
+  @param len     number of bytes to read (at most RECV_SCAN_SIZE) */
+  void read_ahead(os_offset_t offset, size_t len);
+  /** Wait for any pending read_ahead() and discard its result. */
+  void read_ahead_discard();
   inline size_t files_size();
   void close_files() { files.clear(); files.shrink_to_fit(); }
 
@@ -301,12 +315,31 @@ struct recv_sys_t
   @retval nullptr if the page cannot be initialized based on log records */
   buf_block_t *recover_low(const page_id_t page_id);
 
+  /** Recover the first pages of tablespaces whose creation was deferred,
+  or discard the log for deleted ones, before apply_part() is invoked. */
+  inline void apply_deferred();
+
   /** All found log files (multiple ones are possible if we are upgrading
   from before MariaDB Server 10.5.1) */
   std::vector<log_file_t> files;
 
   void open_log_files_if_needed();
 
+  /** Read redo log from the files.
+  @param offset  byte offset from the start of the first log file
+  @param buf     buffer to read into */
+  void read_low(os_offset_t offset, span<byte> buf);
+  /** The callback of read_ahead_task */
+  static void read_ahead_callback(void*);
+  /** Task for read_ahead() */
+  tpool::waitable_task read_ahead_task{read_ahead_callback, nullptr};
+  /** Buffer for read_ahead(), or nullptr if not allocated */
+  byte *ahead_buf= nullptr;
+  /** read_ahead() offset from the start of the first log file */
+  os_offset_t ahead_offset= 0;
+  /** length of read_ahead(), in bytes; 0 if there is none */
+  size_t ahead_len= 0;
+
   /** Base node of the redo block list.
   List elements are linked via buf_block_t::unzip_LRU. */
   UT_LIST_BASE_NODE_T(buf_block_t) blocks;
@@ -319,6 +352,11 @@ struct recv_sys_t
   /** Apply buffered log to persistent data pages.
   @param last_batch     whether it is possible to write more redo log */
   void apply(bool last_batch);
+  /** Apply buffered log to the pages of one partition of pages.
+  This is invoked by apply() and by concurrent recovery tasks.
+  @param part     partition to process
+  @param n_parts  number of partitions */
+  void apply_part(unsigned part, unsigned n_parts);
 
 #ifdef UNIV_DEBUG
   /** whether all redo log in the current batch has been applied */
@@ -206,8 +206,9 @@ class IORequest
     PUNCH_RANGE= WRITE_SYNC | 128,
   };
 
-  constexpr IORequest(buf_page_t *bpage, fil_node_t *node, Type type) :
-    bpage(bpage), node(node), type(type) {}
+  constexpr IORequest(buf_page_t *bpage, fil_node_t *node, Type type,
+                      uint32_t n_pages= 1) :
+    bpage(bpage), node(node), type(type), n_pages(n_pages) {}
 
   constexpr IORequest(Type type= READ_SYNC, buf_page_t *bpage= nullptr) :
     bpage(bpage), type(type) {}
@@ -244,6 +245,10 @@ class IORequest
 
   /** Request type bit flags */
   const Type type;
+
+  /** Number of adjacent pages starting at bpage that are written
+  by a single request (see buf_dblwr_t::flush_buffered_writes_completed()) */
+  const uint32_t n_pages= 1;
 };
 
 constexpr IORequest IORequestRead(IORequest::READ_SYNC);
@@ -63,9 +63,19 @@ class ReadViewBase
   */
   trx_id_t m_low_limit_no;
 
+  /**
+    trx_sys.get_rw_trx_hash_erased() when this snapshot was taken. If neither
+    it nor trx_sys.get_max_trx_id() has changed, the snapshot is still
+    current and can be reused as is.
+  */
+  uint64_t m_rw_trx_hash_erased;
+
 protected:
   bool empty() { return m_ids.empty(); }
 
+  /** @return whether the snapshot would be the same if taken now */
+  inline bool is_current() const;
+
   /** @return the up limit id */
   trx_id_t up_limit_id() const { return m_up_limit_id; }
 
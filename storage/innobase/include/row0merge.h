@@ -103,6 +103,15 @@ struct merge_file_t {
 	ib_uint64_t	n_rec;		/*!< number of records in the file */
 };
 
+/** Partitioning of the output of the last merge pass into several
+runs, which can be inserted into the index in parallel */
+struct row_merge_split_t {
+	ib_uint64_t	n_rec;		/*!< number of records per run */
+	ulint		n;		/*!< number of runs */
+	ulint		max;		/*!< maximum number of runs */
+	ulint*		offset;		/*!< first offset of each run */
+};
+
 /** Index field definition */
 struct index_field_t {
 	ulint		col_no;		/*!< column offset */
@@ -345,6 +354,8 @@ row_merge_file_create(
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL, stage->begin_phase_sort() will be called initially
 and then stage->inc() will be called for each record processed.
+@param[in]	n_threads	maximum number of threads for merging runs
+@param[in,out]	split		how to partition the sorted output, or NULL
 @return DB_SUCCESS or error code */
 dberr_t
 row_merge_sort(
@@ -359,7 +370,9 @@ row_merge_sort(
 	const double	pct_cost,
 	row_merge_block_t*	crypt_block,
 	ulint			space,
-	ut_stage_alter_t*	stage = NULL)
+	ut_stage_alter_t*	stage = NULL,
+	ulint			n_threads = 1,
+	row_merge_split_t*	split = NULL)
 	MY_ATTRIBUTE((warn_unused_result));
 
 /*********************************************************************//**
@@ -420,4 +433,89 @@ row_merge_read_rec(
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space)	   /*!< in: space id */
 	MY_ATTRIBUTE((warn_unused_result));
+
+/** Index entries of an INSERT into an empty table, which are buffered
+and sorted per index, and finally loaded with BtrBulk. The rows are
+covered by a single TRX_UNDO_EMPTY undo log record. */
+class row_merge_bulk_t
+{
+	/** Sort buffer and temporary file of an index */
+	struct index_buf_t {
+		/** the index */
+		dict_index_t*		index;
+		/** sort buffer, or NULL if no entries were added */
+		row_merge_buf_t*	buf;
+		/** sorted runs that did not fit in buf */
+		merge_file_t		file;
+	};
+
+	/** Buffers of the indexes, in the order of dict_table_t::indexes */
+	std::vector<index_buf_t, ut_allocator<index_buf_t> >	m_bufs;
+	/** I/O buffer of 3 * srv_sort_buf_size, or NULL */
+	row_merge_block_t*	m_block;
+	/** encryption buffer of 3 * srv_sort_buf_size, or NULL */
+	row_merge_block_t*	m_crypt_block;
+	/** allocation of m_block */
+	ut_new_pfx_t		m_block_pfx;
+	/** allocation of m_crypt_block */
+	ut_new_pfx_t		m_crypt_pfx;
+	/** temporary file for merge sort */
+	pfs_os_file_t		m_tmpfd;
+	/** largest AUTO_INCREMENT value in the clustered index entries */
+	ib_uint64_t		m_autoinc;
+	/** number of buffered clustered index entries */
+	ulint			m_n_rows;
+
+	/** Allocate m_block and m_crypt_block if needed.
+	@return whether the allocation succeeded */
+	bool alloc_block();
+
+	/** Sort the buffer of an index and write it to the temporary file.
+	@param[in,out]	b	buffer of an index
+	@param[in,out]	trx	transaction
+	@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+	@return error code */
+	dberr_t write_buf(index_buf_t& b, trx_t* trx, struct TABLE* table);
+
+	/** Load the index entries of an index.
+	@param[in,out]	b	buffer of an index
+	@param[in,out]	trx	transaction
+	@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+	@return error code */
+	dberr_t write_index(index_buf_t& b, trx_t* trx, struct TABLE* table);
+public:
+	/** Constructor
+	@param[in]	table	table that is being inserted to */
+	explicit row_merge_bulk_t(const dict_table_t* table);
+
+	/** Destructor. Discards any buffered entries. */
+	~row_merge_bulk_t();
+
+	/** @return whether rows inserted into an empty table can be
+	buffered and loaded with BtrBulk
+	@param[in]	table	the table
+	@param[in]	trx	transaction */
+	static bool is_supported(const dict_table_t& table, const trx_t& trx);
+
+	/** @return whether a clustered index entry can be buffered
+	@param[in]	index	clustered index
+	@param[in]	entry	entry to insert */
+	static bool can_buffer(const dict_index_t& index,
+			       const dtuple_t& entry);
+
+	/** Buffer an index entry.
+	@param[in]	index	index of the entry
+	@param[in]	entry	entry to insert
+	@param[in,out]	trx	transaction
+	@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+	@return error code */
+	dberr_t add(const dict_index_t* index, const dtuple_t& entry,
+		    trx_t* trx, struct TABLE* table);
+
+	/** Sort the buffered entries and load them into all indexes.
+	@param[in,out]	trx	transaction
+	@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+	@return error code */
+	dberr_t write_to_table(trx_t* trx, struct TABLE* table);
+};
 #endif /* row0merge.h */
@@ -489,10 +489,21 @@ struct mysql_row_templ_t {
 	ulint	is_virtual;		/*!< if a column is a virtual column */
 };
 
+/* Initial number of rows to cache in fetch_cache */
 #define MYSQL_FETCH_CACHE_SIZE		8
+/* The number of rows in fetch_cache is doubled while a scan continues,
+up to this many rows */
+#define MYSQL_FETCH_CACHE_MAX		64
+/* ...as long as the rows do not occupy more than this many bytes */
+#define MYSQL_FETCH_CACHE_BYTES		65536
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
 
+/* Number of leaf pages that innodb_index_read_ahead looks ahead */
+#define MYSQL_READ_AHEAD_PAGES		32
+/* After entering this many leaf pages, an ascending scan reads ahead */
+#define MYSQL_READ_AHEAD_THRESHOLD	2
+
 #define ROW_PREBUILT_ALLOCATED	78540783
 #define ROW_PREBUILT_FREED	26423527
 
@@ -559,6 +570,12 @@ struct row_prebuilt_t {
 					(VARCHAR can be off-page too) */
 	unsigned	versioned_write:1;/*!< whether this is
 					a versioned write */
+	unsigned	ignore_dup_key:1;/*!< whether duplicate keys
+					are ignored row by row, as in
+					INSERT IGNORE */
+	unsigned	bulk_insert_buffer:1;/*!< whether rows inserted
+					into an empty table may be buffered
+					until handler::end_bulk_insert() */
 	mysql_row_templ_t* mysql_template;/*!< template used to transform
 					rows fast between MySQL and Innobase
 					formats; memory for this template
@@ -665,7 +682,7 @@ struct row_prebuilt_t {
 	ulint		n_rows_fetched;	/*!< number of rows fetched after
 					positioning the current cursor */
 	ulint		fetch_direction;/*!< ROW_SEL_NEXT or ROW_SEL_PREV */
-	byte*		fetch_cache[MYSQL_FETCH_CACHE_SIZE];
+	byte*		fetch_cache[MYSQL_FETCH_CACHE_MAX];
 					/*!< a cache for fetched rows if we
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
@@ -683,6 +700,26 @@ struct row_prebuilt_t {
 					fetched row in fetch_cache */
 	ulint		n_fetch_cached;	/*!< number of not yet fetched rows
 					in fetch_cache */
+	ulint		fetch_cache_size;/*!< number of rows to cache in
+					fetch_cache in the current batch */
+	ulint		fetch_cache_alloc;/*!< number of rows allocated
+					for fetch_cache */
+	uint32_t	ra_page_no;	/*!< the leaf page that the scan
+					is positioned on, for
+					innodb_index_read_ahead */
+	ulint		n_ra_leaves;	/*!< number of leaf pages entered
+					after positioning the current cursor */
+	ulint		n_ra_ahead;	/*!< number of leaf pages covered by
+					the latest index read-ahead that the
+					scan has not entered yet */
+	ulint		n_ra_pages;	/*!< number of elements in ra_pages */
+	uint32_t	ra_pages[MYSQL_READ_AHEAD_PAGES];
+					/*!< pages read by the index
+					read-ahead that the scan has not
+					entered yet, in key order */
+	bool		ra_pending;	/*!< whether row_search_mvcc()
+					should read ahead after committing
+					its mini-transaction */
 	mem_heap_t*	blob_heap;	/*!< in SELECTS BLOB fields are copied
 					to this heap */
 	mem_heap_t*	old_vers_heap;	/*!< memory heap where a previous
@@ -145,6 +145,29 @@ struct srv_stats_t
 	/** Number of rows read. */
 	ulint_ctr_n_t		n_rows_read;
 
+	/** Number of batches of rows prefetched by row_search_mvcc() */
+	ulint_ctr_n_t		n_prefetch_batches;
+
+	/** Number of rows prefetched by row_search_mvcc() */
+	ulint_ctr_n_t		n_prefetch_rows;
+
+	/** Number of synchronous page reads by buf_read_page() */
+	ulint_ctr_n_t		page_reads_sync;
+
+	/** Time spent waiting for synchronous page reads, in microseconds */
+	ulint_ctr_n_t		page_reads_sync_us;
+
+	/** Number of pages read by innodb_index_read_ahead */
+	ulint_ctr_n_t		n_ra_pages_read_index;
+
+	/** Number of pages read by innodb_index_read_ahead that the
+	index scan subsequently accessed */
+	ulint_ctr_n_t		n_ra_pages_index_useful;
+
+	/** Number of pages read by innodb_index_read_ahead that the
+	index scan never reached */
+	ulint_ctr_n_t		n_ra_pages_index_wasted;
+
 	/** Number of rows updated */
 	ulint_ctr_n_t		n_rows_updated;
 
@@ -154,6 +177,10 @@ struct srv_stats_t
 	/** Number of rows inserted */
 	ulint_ctr_n_t		n_rows_inserted;
 
+	/** Number of rows that were buffered and loaded into an empty
+	table at the end of a statement */
+	ulint_ctr_n_t		n_rows_bulk_loaded;
+
 	/** Number of system rows read. */
 	ulint_ctr_n_t		n_system_rows_read;
 
@@ -183,6 +210,13 @@ struct srv_stats_t
 
 	/** Number of temporary tablespace blocks decrypted */
 	ulint_ctr_n_t		n_temp_blocks_decrypted;
+
+	/** Number of MVCC snapshots that were reused or copied from
+	the cached trx_sys snapshot */
+	ulint_ctr_n_t		n_read_views_reused;
+
+	/** Number of MVCC snapshots that were built from rw_trx_hash */
+	ulint_ctr_n_t		n_read_views_rebuilt;
 };
 
 /** We are prepared for a situation that we have this many threads waiting for
@@ -247,6 +281,9 @@ use simulated aio.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
 extern my_bool	srv_numa_interleave;
+/** innodb_numa_local: whether to bind buffer pool chunks to NUMA nodes
+and prefer allocating blocks on the node of the requesting thread */
+extern my_bool	srv_numa_local;
 
 /* Use atomic writes i.e disable doublewrite buffer */
 extern my_bool srv_use_atomic_writes;
@@ -296,6 +333,8 @@ extern ulonglong	srv_log_file_size;
 extern ulong	srv_log_buffer_size;
 extern ulong	srv_flush_log_at_trx_commit;
 extern uint	srv_flush_log_at_timeout;
+/** innodb_log_group_commit_delay, in microseconds */
+extern uint	srv_log_group_commit_delay;
 extern ulong	srv_log_write_ahead_size;
 extern my_bool	srv_adaptive_flushing;
 extern my_bool	srv_flush_sync;
@@ -332,6 +371,9 @@ extern ulint	srv_buf_pool_base_size;
 extern ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 extern ulong	srv_buf_pool_dump_pct;
+/** innodb_buffer_pool_dump_interval: seconds between periodic
+buffer pool dumps, or 0 to only dump on request and at shutdown */
+extern uint	srv_buf_pool_dump_interval;
 #ifdef UNIV_DEBUG
 /** Abort load after this amount of pages */
 extern ulong srv_buf_pool_load_pages_abort;
@@ -344,6 +386,7 @@ extern ulong	srv_checksum_algorithm;
 
 extern uint	srv_n_file_io_threads;
 extern my_bool	srv_random_read_ahead;
+extern my_bool	srv_index_read_ahead;
 extern ulong	srv_read_ahead_threshold;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
@@ -703,6 +746,8 @@ struct export_var_t{
 #ifdef BTR_CUR_HASH_ADAPT
 	ulint innodb_ahi_hit;
 	ulint innodb_ahi_miss;
+	/** btr_search_n_latch_fail */
+	ulint innodb_ahi_latch_fail;
 #endif /* BTR_CUR_HASH_ADAPT */
 	char  innodb_buffer_pool_dump_status[OS_FILE_MAX_PATH + 128];/*!< Buf pool dump status */
 	char  innodb_buffer_pool_load_status[OS_FILE_MAX_PATH + 128];/*!< Buf pool load status */
@@ -727,6 +772,11 @@ struct export_var_t{
 	ulint innodb_buffer_pool_read_ahead_rnd;/*!< srv_read_ahead_rnd */
 	ulint innodb_buffer_pool_read_ahead;	/*!< srv_read_ahead */
 	ulint innodb_buffer_pool_read_ahead_evicted;/*!< srv_read_ahead evicted*/
+	ulint innodb_buffer_pool_read_ahead_index;/*!< n_ra_pages_read_index */
+	ulint innodb_buffer_pool_read_ahead_index_useful;
+					/*!< n_ra_pages_index_useful */
+	ulint innodb_buffer_pool_read_ahead_index_wasted;
+					/*!< n_ra_pages_index_wasted */
 	ulint innodb_checkpoint_age;
 	ulint innodb_checkpoint_max_age;
 	ulint innodb_data_pending_reads;	/*!< Pending reads */
@@ -736,6 +786,8 @@ struct export_var_t{
 	ulint innodb_data_read;			/*!< Data bytes read */
 	ulint innodb_data_writes;		/*!< I/O write requests */
 	ulint innodb_data_written;		/*!< Data bytes written */
+	ulint innodb_data_write_avg_bytes;	/*!< innodb_data_written
+						/ innodb_data_writes */
 	ulint innodb_data_reads;		/*!< I/O read requests */
 	ulint innodb_dblwr_pages_written;	/*!< srv_dblwr_pages_written */
 	ulint innodb_dblwr_writes;		/*!< srv_dblwr_writes */
@@ -754,6 +806,10 @@ struct export_var_t{
 	ulint innodb_mem_dictionary;
 	lsn_t innodb_os_log_written;		/*!< srv_os_log_written */
 	ulint innodb_os_log_fsyncs;		/*!< n_log_flushes */
+	ulint innodb_os_log_fsync_batch_avg;	/*!< average number of
+						log flush requests per fsync */
+	ulint innodb_os_log_fsyncs_saved;	/*!< log flush requests
+						that did not need own fsync */
 	ulint innodb_os_log_pending_writes;	/*!< srv_os_log_pending_writes */
 	ulint innodb_os_log_pending_fsyncs;	/*!< n_pending_log_flushes */
 	ulint innodb_row_lock_waits;		/*!< srv_n_lock_wait_count */
@@ -766,9 +822,14 @@ struct export_var_t{
 	ulint innodb_row_lock_time_max;		/*!< srv_n_lock_max_wait_time
 						/ 1000 */
 	ulint innodb_rows_read;			/*!< srv_n_rows_read */
+	ulint innodb_row_prefetch_batches;	/*!< n_prefetch_batches */
+	ulint innodb_row_prefetch_rows;		/*!< n_prefetch_rows */
 	ulint innodb_rows_inserted;		/*!< srv_n_rows_inserted */
+	ulint innodb_rows_bulk_loaded;		/*!< n_rows_bulk_loaded */
 	ulint innodb_rows_updated;		/*!< srv_n_rows_updated */
 	ulint innodb_rows_deleted;		/*!< srv_n_rows_deleted */
+	ulint innodb_read_views_reused;		/*!< n_read_views_reused */
+	ulint innodb_read_views_rebuilt;	/*!< n_read_views_rebuilt */
 	ulint innodb_system_rows_read; /*!< srv_n_system_rows_read */
 	ulint innodb_system_rows_inserted; /*!< srv_n_system_rows_inserted */
 	ulint innodb_system_rows_updated; /*!< srv_n_system_rows_updated */
@@ -837,6 +898,8 @@ struct export_var_t{
 	ulint innodb_encryption_rotation_pages_modified;
 	ulint innodb_encryption_rotation_pages_flushed;
 	ulint innodb_encryption_rotation_estimated_iops;
+	ulint innodb_encryption_rotation_pages_per_second;
+	ulint innodb_encryption_rotation_allowed_iops;
 	int64_t innodb_encryption_key_requests;
 	int64_t innodb_key_rotation_list_length;
 };
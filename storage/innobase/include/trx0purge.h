@@ -32,6 +32,7 @@ Created 3/26/1996 Heikki Tuuri
 #include "srw_lock.h"
 
 #include <queue>
+#include <vector>
 
 /** A dummy undo record used as a return value when we have a whole undo log
 which needs no purge */
@@ -200,6 +201,27 @@ class purge_sys_t
 
 	/** Heap for reading the undo log records */
 	mem_heap_t*	heap;
+
+	/** Per-table statistics of a purge batch */
+	struct table_stats
+	{
+		/** table identifier */
+		table_id_t	id;
+		/** trx_t::no of the oldest transaction in the batch
+		that modified the table */
+		trx_id_t	trx_no;
+		/** number of undo log records */
+		ulint		n_recs;
+		/** number of purge tasks that the records were
+		distributed to */
+		ulint		n_tasks;
+	};
+	/** Mutex protecting batch_tables */
+	srw_mutex	stats_mutex;
+	/** Statistics of the tables in the latest purge batch that
+	processed any undo log records,
+	for INFORMATION_SCHEMA.INNODB_PURGE_TABLES */
+	std::vector<table_stats>	batch_tables;
   /**
     Constructor.
 
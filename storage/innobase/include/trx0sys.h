@@ -858,6 +858,36 @@ class trx_sys_t
   MY_ALIGNED(CACHE_LINE_SIZE) std::atomic<trx_id_t> m_rw_trx_hash_version;
 
 
+  /**
+    Number of transactions removed from rw_trx_hash by deregister_rw().
+
+    Every other change to the contents of rw_trx_hash that is relevant to
+    MVCC increments m_max_trx_id, so the pair (m_max_trx_id,
+    m_rw_trx_hash_erased) identifies the result of snapshot_ids().
+
+    @sa deregister_rw()
+    @sa snapshot_ids()
+  */
+  std::atomic<uint64_t> m_rw_trx_hash_erased;
+
+
+  /** Protects m_snapshot */
+  MY_ALIGNED(CACHE_LINE_SIZE) srw_lock_low m_snapshot_latch;
+
+  /** The most recent snapshot_ids() result that was built from rw_trx_hash */
+  struct
+  {
+    /** sorted identifiers of the active transactions */
+    trx_ids_t ids;
+    /** m_max_trx_id at the time of the snapshot */
+    trx_id_t max_trx_id;
+    /** min(no) of the active transactions, or max_trx_id */
+    trx_id_t min_trx_no;
+    /** m_rw_trx_hash_erased at the time of the snapshot */
+    uint64_t erased;
+  } m_snapshot;
+
+
   bool m_initialised;
 
 public:
@@ -1002,6 +1032,12 @@ class trx_sys_t
   /**
     Takes MVCC snapshot.
 
+    The most recently built snapshot is cached in m_snapshot. If no
+    transaction was registered, deregistered or assigned a serialisation
+    number since it was built, it is copied instead of iterating
+    rw_trx_hash. Otherwise rw_trx_hash is iterated, and the result is
+    published in m_snapshot unless another thread is doing that.
+
     To reduce malloc probablility we reserve rw_trx_hash.size() + 32 elements
     in ids.
 
@@ -1010,32 +1046,73 @@ class trx_sys_t
 
     We rely on get_rw_trx_hash_version() to issue ACQUIRE memory barrier so
     that loading of m_rw_trx_hash_version happens before accessing rw_trx_hash.
+    For the same reason m_rw_trx_hash_erased must be loaded before it: if
+    the count matches that of m_snapshot, no transaction that was
+    deregistered before this call can be included in m_snapshot.
 
     To optimise snapshot creation rw_trx_hash.iterate() is being used instead
     of rw_trx_hash.iterate_no_dups(). It means that some transaction
     identifiers may appear multiple times in ids.
 
     @param[in,out] caller_trx used to get access to rw_trx_hash_pins
-    @param[out]    ids        array to store registered transaction identifiers
+    @param[out]    ids        sorted array of registered transaction
+                              identifiers
     @param[out]    max_trx_id variable to store m_max_trx_id value
     @param[out]    mix_trx_no variable to store min(no) value
+    @param[out]    erased     variable to store m_rw_trx_hash_erased value
+    @return whether the cached snapshot was reused
   */
 
-  void snapshot_ids(trx_t *caller_trx, trx_ids_t *ids, trx_id_t *max_trx_id,
-                    trx_id_t *min_trx_no)
+  bool snapshot_ids(trx_t *caller_trx, trx_ids_t *ids, trx_id_t *max_trx_id,
+                    trx_id_t *min_trx_no, uint64_t *erased)
   {
-    snapshot_ids_arg arg(ids);
+    *erased= get_rw_trx_hash_erased();
 
-    while ((arg.m_id= get_rw_trx_hash_version()) != get_max_trx_id())
+    trx_id_t id;
+    while ((id= get_rw_trx_hash_version()) != get_max_trx_id())
       ut_delay(1);
-    arg.m_no= arg.m_id;
+    *max_trx_id= id;
+
+    m_snapshot_latch.rd_lock();
+    if (m_snapshot.max_trx_id == id && m_snapshot.erased == *erased)
+    {
+      ids->assign(m_snapshot.ids.begin(), m_snapshot.ids.end());
+      *min_trx_no= m_snapshot.min_trx_no;
+      m_snapshot_latch.rd_unlock();
+      return true;
+    }
+    m_snapshot_latch.rd_unlock();
+
+    snapshot_ids_arg arg(ids);
+    arg.m_id= id;
+    arg.m_no= id;
 
     ids->clear();
     ids->reserve(rw_trx_hash.size() + 32);
     rw_trx_hash.iterate(caller_trx, copy_one_id, &arg);
-
-    *max_trx_id= arg.m_id;
+    std::sort(ids->begin(), ids->end());
     *min_trx_no= arg.m_no;
+
+    if (m_snapshot_latch.wr_lock_try())
+    {
+      if (m_snapshot.max_trx_id < id ||
+          (m_snapshot.max_trx_id == id && m_snapshot.erased < *erased))
+      {
+        m_snapshot.ids.assign(ids->begin(), ids->end());
+        m_snapshot.max_trx_id= id;
+        m_snapshot.min_trx_no= arg.m_no;
+        m_snapshot.erased= *erased;
+      }
+      m_snapshot_latch.wr_unlock();
+    }
+    return false;
+  }
+
+
+  /** @return the number of transactions removed by deregister_rw() */
+  uint64_t get_rw_trx_hash_erased() const
+  {
+    return m_rw_trx_hash_erased.load(std::memory_order_acquire);
   }
 
 
@@ -1044,6 +1121,8 @@ class trx_sys_t
   {
     m_max_trx_id= value;
     m_rw_trx_hash_version.store(value, std::memory_order_relaxed);
+    m_snapshot.ids.clear();
+    m_snapshot.max_trx_id= 0;
   }
 
 
@@ -1109,11 +1188,16 @@ class trx_sys_t
 
     Transaction is removed from rw_trx_hash, which releases all implicit locks.
     MVCC snapshot won't see this transaction anymore.
+
+    We rely on m_rw_trx_hash_erased increment to issue RELEASE memory
+    barrier, so that a snapshot_ids() call that observes the new value
+    cannot reuse a cached snapshot that includes this transaction.
   */
 
   void deregister_rw(trx_t *trx)
   {
     rw_trx_hash.erase(trx);
+    m_rw_trx_hash_erased.fetch_add(1, std::memory_order_release);
   }
 
 
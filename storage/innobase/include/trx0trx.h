@@ -42,6 +42,7 @@ Created 3/26/1996 Heikki Tuuri
 // Forward declaration
 struct mtr_t;
 struct rw_trx_hash_element_t;
+class row_merge_bulk_t;
 
 /******************************************************************//**
 Set detailed error message for the transaction. */
@@ -397,9 +398,15 @@ class trx_mod_table_time_t
   (NONE= no versioning, BULK= the table was dropped) */
   undo_no_t first_versioned= NONE;
 public:
+  /** Buffered rows of an insert into an empty table, or nullptr */
+  row_merge_bulk_t *bulk_store= nullptr;
+
   /** Constructor
   @param rows   number of modified rows so far */
   trx_mod_table_time_t(undo_no_t rows) : first(rows) { ut_ad(rows < LIMIT); }
+  trx_mod_table_time_t(const trx_mod_table_time_t&)= delete;
+  /** Destructor. Discards any buffered rows. */
+  ~trx_mod_table_time_t();
 
 #ifdef UNIV_DEBUG
   /** Validation
@@ -1014,6 +1021,23 @@ struct trx_t : ilist_node<>
       t.second.end_bulk_insert();
   }
 
+  /** @return the buffered rows of an insert into an empty table
+  @param table   table that is being inserted to
+  @retval nullptr if no rows are being buffered */
+  row_merge_bulk_t *bulk_buffer(const dict_table_t &table) const
+  {
+    auto it= mod_tables.find(const_cast<dict_table_t*>(&table));
+    return it == mod_tables.end() ? nullptr : it->second.bulk_store;
+  }
+
+  /** Load the rows that were buffered for an insert into an empty table.
+  The buffer is freed even if an error is returned.
+  @param table        table that is being inserted to
+  @param mysql_table  table handle for reporting duplicates, or nullptr
+  @return error code */
+  dberr_t bulk_insert_apply(const dict_table_t &table,
+                            struct TABLE *mysql_table);
+
   /** @return whether a bulk insert into empty table is in progress */
   bool is_bulk_insert() const
   {
@@ -273,26 +273,32 @@ ut_stage_alter_t::inc(ulint inc_val)
 		/* fall through */
 	case INSERT: {
 		/* Increment the progress every nth record. During
-		sort and insert phases, this method is called once per
-		record processed. We need fractional point numbers here
-		because "records per page" is such a number naturally and
-		to avoid rounding skew we want, for example: if there are
+		sort and insert phases, this method is called for
+		inc_val records processed. We need fractional point numbers
+		here because "records per page" is such a number naturally
+		and to avoid rounding skew we want, for example: if there are
 		(double) N records per page, then the work_completed
-	        should be incremented on the inc() calls round(k*N),
-		for k=1,2,3... */
+	        should be incremented at the records round(k*N),
+		for k=0,1,2,... */
 		const double	every_nth = m_n_recs_per_page *
 			static_cast<double>(multi_factor);
 
-		const ulint	k = static_cast<ulint>(
-			round(static_cast<double>(m_n_recs_processed) /
-			      every_nth));
+		/* The number of k for which round(k*N) < n_recs */
+		const auto	n_nth = [every_nth](ulint n_recs) {
+			return n_recs
+				? static_cast<ulint>(ceil(
+					(static_cast<double>(n_recs) - 0.5)
+					/ every_nth))
+				: 0;
+		};
 
-		const ulint	nth = static_cast<ulint>(
-			round(static_cast<double>(k) * every_nth));
+		const ulint	prev = m_n_recs_processed;
 
-		should_proceed = m_n_recs_processed == nth;
+		m_n_recs_processed += inc_val;
 
-		m_n_recs_processed++;
+		inc_val = n_nth(m_n_recs_processed) - n_nth(prev);
+
+		should_proceed = inc_val != 0;
 
 		break;
 	}
@@ -240,6 +240,15 @@ static void lock_table_print(FILE* file, const lock_t* lock);
 @param[in,out]	mtr	mini-transaction for accessing the record */
 static void lock_rec_print(FILE* file, const lock_t* lock, mtr_t& mtr);
 
+/** Resolve deadlocks that Deadlock::check_and_resolve() deferred.
+@see lock_sys_t::deadlock_check() */
+static void lock_deadlock_check_callback(void*);
+/* Avoid running multiple deadlock checks in parallel */
+static tpool::task_group deadlock_check_group(1);
+static tpool::waitable_task deadlock_check_task(lock_deadlock_check_callback,
+                                                nullptr,
+                                                &deadlock_check_group);
+
 namespace Deadlock
 {
   /** Whether to_check may be nonempty */
@@ -444,6 +453,8 @@ void lock_sys_t::close()
   if (!m_initialised)
     return;
 
+  deadlock_check_task.wait();
+
   if (lock_latest_err_file)
   {
     my_fclose(lock_latest_err_file, MYF(MY_WME));
@@ -1720,9 +1731,10 @@ dberr_t lock_wait(que_thr_t *thr)
 
   In any case, it is safe to read the memory that wait_lock points to,
   even though we are not holding any mutex. We are only reading
-  wait_lock->type_mode & (LOCK_TABLE | LOCK_AUTO_INC), which will be
-  unaffected by any page split or merge operation. (Furthermore,
-  table lock objects will never be cloned or moved.) */
+  wait_lock->type_mode & (LOCK_TABLE | LOCK_AUTO_INC) and the table or
+  index that the lock is on, which will be unaffected by any page split
+  or merge operation. (Furthermore, table lock objects will never be
+  cloned or moved.) */
   const lock_t *const wait_lock= trx->lock.wait_lock;
 
   if (!wait_lock)
@@ -1765,6 +1777,7 @@ dberr_t lock_wait(que_thr_t *thr)
   dberr_t error_state= DB_SUCCESS;
 
   mysql_mutex_lock(&lock_sys.wait_mutex);
+  trx->error_state= DB_SUCCESS;
   if (trx->lock.wait_lock)
   {
     if (Deadlock::check_and_resolve(trx))
@@ -1782,11 +1795,15 @@ dberr_t lock_wait(que_thr_t *thr)
 
 #ifdef HAVE_REPLICATION
   if (rpl)
+  {
     lock_wait_rpl_report(trx);
+    /* lock_sys.wait_mutex may have been released, and the lock may
+    have been granted, or a deferred deadlock check may have chosen
+    trx as the victim. */
+    error_state= trx->error_state;
+  }
 #endif
 
-  trx->error_state= DB_SUCCESS;
-
   while (trx->lock.wait_lock)
   {
     int err;
@@ -1824,8 +1841,16 @@ dberr_t lock_wait(que_thr_t *thr)
     break;
   }
 
-  if (row_lock_wait)
-    lock_sys.wait_resume(trx->mysql_thd, suspend_time, my_hrtime_coarse());
+  {
+    const my_hrtime_t now= my_hrtime_coarse();
+    if (row_lock_wait)
+      lock_sys.wait_resume(trx->mysql_thd, suspend_time, now);
+    if (now.val >= suspend_time.val)
+      (type_mode & LOCK_TABLE
+       ? wait_lock->un_member.tab_lock.table->lock_waits
+       : wait_lock->index->lock_waits).
+        add(ulint((now.val - suspend_time.val) / 1000));
+  }
 
 end_wait:
   if (lock_t *lock= trx->lock.wait_lock)
@@ -5066,6 +5091,49 @@ lock_clust_rec_modify_check_and_lock(
 	return(err);
 }
 
+/** Release an explicit LOCK_X|LOCK_REC_NOT_GAP on a clustered index record
+that the transaction has just modified, unless other transactions are
+waiting for the record. The record will remain implicitly locked by
+DB_TRX_ID=trx.id, and lock_rec_convert_impl_to_expl() will create an
+explicit lock on demand.
+@param block  buffer block of rec, latched by the caller
+@param rec    clustered index record
+@param trx    transaction that modified rec */
+void lock_clust_rec_release_to_impl(const buf_block_t &block,
+                                    const rec_t *rec, trx_t *trx)
+{
+  ut_ad(page_rec_is_user_rec(rec));
+  ut_ad(block.frame == page_align(rec));
+  ut_ad(trx->state == TRX_STATE_ACTIVE);
+  ut_ad(!trx->lock.wait_lock);
+
+  const page_id_t id{block.page.id()};
+  const ulint heap_no= page_rec_get_heap_no(rec);
+  LockGuard g{lock_sys.rec_hash, id};
+  lock_t *own= nullptr;
+
+  for (lock_t *lock= lock_sys_t::get_first(g.cell(), id, heap_no); lock;
+       lock= lock_rec_get_next(heap_no, lock))
+  {
+    /* Keep the lock if another transaction is waiting for the record,
+    or if we are holding any other lock on it. */
+    if (lock->trx != trx || own ||
+        lock->type_mode != (LOCK_X | LOCK_REC_NOT_GAP))
+      return;
+    own= lock;
+  }
+
+  if (!own)
+    return;
+
+  ut_ad(dict_index_is_clust(own->index));
+  trx->mutex_lock();
+  lock_rec_reset_nth_bit(own, heap_no);
+  if (lock_rec_find_set_bit(own) == ULINT_UNDEFINED)
+    lock_rec_dequeue_from_page(own, false);
+  trx->mutex_unlock();
+}
+
 /*********************************************************************//**
 Checks if locks of other transactions prevent an immediate modify (delete
 mark or delete unmark) of a secondary index record.
@@ -5385,27 +5453,36 @@ lock_trx_holds_autoinc_locks(
 /** Release all AUTO_INCREMENT locks of the transaction. */
 static void lock_release_autoinc_locks(trx_t *trx)
 {
+  /* Only the thread that is executing trx may modify the vector,
+  because the transaction is not waiting for any lock. */
+  ut_ad(!trx->lock.wait_lock);
+  auto autoinc_locks= trx->autoinc_locks;
+  ut_a(autoinc_locks);
+
+  /* Like lock_table(), only hold lock_sys.latch in shared mode
+  together with the table lock_mutex, so that releasing AUTO_INCREMENT
+  locks at the end of each statement will not block other record or
+  table locking. */
+  lock_sys.rd_lock(SRW_LOCK_CALL);
+
+  /* We release the locks in the reverse order. This is to avoid
+  searching the vector for the element to delete at the lower level.
+  See (lock_table_remove_low()) for details. */
+  while (ulint size= ib_vector_size(autoinc_locks))
   {
-    LockMutexGuard g{SRW_LOCK_CALL};
-    mysql_mutex_lock(&lock_sys.wait_mutex);
+    lock_t *lock= *static_cast<lock_t**>
+      (ib_vector_get(autoinc_locks, size - 1));
+    ut_ad(lock->type_mode == (LOCK_AUTO_INC | LOCK_TABLE));
+    dict_table_t *table= lock->un_member.tab_lock.table;
+    table->lock_mutex_lock();
     trx->mutex_lock();
-    auto autoinc_locks= trx->autoinc_locks;
-    ut_a(autoinc_locks);
-
-    /* We release the locks in the reverse order. This is to avoid
-    searching the vector for the element to delete at the lower level.
-    See (lock_table_remove_low()) for details. */
-    while (ulint size= ib_vector_size(autoinc_locks))
-    {
-      lock_t *lock= *static_cast<lock_t**>
-        (ib_vector_get(autoinc_locks, size - 1));
-      ut_ad(lock->type_mode == (LOCK_AUTO_INC | LOCK_TABLE));
-      lock_table_dequeue(lock, true);
-      lock_trx_table_locks_remove(lock);
-    }
+    lock_table_dequeue(lock, false);
+    lock_trx_table_locks_remove(lock);
+    trx->mutex_unlock();
+    table->lock_mutex_unlock();
   }
-  mysql_mutex_unlock(&lock_sys.wait_mutex);
-  trx->mutex_unlock();
+
+  lock_sys.rd_unlock();
 }
 
 /** Cancel a waiting lock request and release possibly waiting transactions */
@@ -6002,8 +6079,39 @@ static bool Deadlock::check_and_resolve(trx_t *trx)
   if (!innodb_deadlock_detect)
     return false;
 
-  if (UNIV_LIKELY_NULL(find_cycle(trx)) && report(trx, true) == trx)
-    return true;
+  if (UNIV_LIKELY_NULL(find_cycle(trx)))
+  {
+    bool latched= lock_sys.wr_lock_try();
+    DBUG_EXECUTE_IF("innodb_deadlock_check_deferred",
+                    if (latched && srv_thread_pool)
+                    {
+                      lock_sys.wr_unlock();
+                      latched= false;
+                    });
+    if (latched)
+    {
+      trx_t *victim= report(trx, false);
+      lock_sys.wr_unlock();
+      if (victim == trx)
+        return true;
+    }
+    else if (srv_thread_pool)
+    {
+      /* Rather than stalling this thread (and, while waiting for
+      lock_sys.latch, every other thread that would acquire
+      lock_sys.wait_mutex), let a background task choose and abort
+      the victim. If that is trx, lock_wait_end() will set
+      trx->error_state= DB_DEADLOCK. The key in to_check is
+      trx->lock.wait_trx, just like in lock_rec_dequeue_from_page(). */
+      ut_ad(trx->lock.wait_trx);
+      Deadlock::to_check.emplace(trx->lock.wait_trx);
+      Deadlock::to_be_checked= true;
+      srv_thread_pool->submit_task(&deadlock_check_task);
+      return false;
+    }
+    else if (report(trx, true) == trx)
+      return true;
+  }
 
   if (UNIV_LIKELY(!trx->lock.was_chosen_as_deadlock_victim))
     return false;
@@ -6015,6 +6123,14 @@ static bool Deadlock::check_and_resolve(trx_t *trx)
   return true;
 }
 
+/** Resolve deadlocks that Deadlock::check_and_resolve() deferred. */
+static void lock_deadlock_check_callback(void*)
+{
+  mysql_mutex_lock(&lock_sys.wait_mutex);
+  lock_sys.deadlock_check();
+  mysql_mutex_unlock(&lock_sys.wait_mutex);
+}
+
 /** Check for deadlocks while holding only lock_sys.wait_mutex. */
 void lock_sys_t::deadlock_check()
 {
@@ -800,10 +800,14 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key,
     return;
   }
 
-  if (flush_to_disk &&
-    flush_lock.acquire(lsn, callback) != group_commit_lock::ACQUIRED)
+  if (flush_to_disk)
   {
-    return;
+    if (flush_lock.acquire(lsn, callback) != group_commit_lock::ACQUIRED)
+      return;
+    /* Collect more commits into this flush if they are arriving fast
+    compared to the duration of a flush. */
+    if (const uint delay= srv_log_group_commit_delay)
+      flush_lock.batch_delay(delay * 1000ULL);
   }
 
   if (write_lock.acquire(lsn, flush_to_disk?0:callback) ==
@@ -834,6 +838,15 @@ void log_write_up_to(lsn_t lsn, bool flush_to_disk, bool rotate_key,
   DBUG_EXECUTE_IF("crash_after_log_write_upto", DBUG_SUICIDE(););
 }
 
+/** Get the group commit statistics of log_write_up_to(flush_to_disk=true).
+@param[out]	requests	number of requests for flushing the log
+@param[out]	batches		number of log flushes that were initiated */
+void log_flush_batch_stats(size_t *requests, size_t *batches)
+{
+  *requests= flush_lock.requests();
+  *batches= flush_lock.batches();
+}
+
 /** write to the log file up to the last log entry.
 @param[in]	sync	whether we want the written log
 also to be flushed to disk. */
@@ -1043,16 +1043,63 @@ void recv_sys_t::open_log_files_if_needed()
   }
 }
 
-void recv_sys_t::read(os_offset_t total_offset, span<byte> buf)
+void recv_sys_t::read_low(os_offset_t total_offset, span<byte> buf)
 {
-  open_log_files_if_needed();
-
   size_t file_idx= static_cast<size_t>(total_offset / log_sys.log.file_size);
   os_offset_t offset= total_offset % log_sys.log.file_size;
   dberr_t err= recv_sys.files[file_idx].read(offset, buf);
   ut_a(err == DB_SUCCESS);
 }
 
+void recv_sys_t::read(os_offset_t total_offset, span<byte> buf)
+{
+  open_log_files_if_needed();
+
+  if (ahead_len)
+  {
+    read_ahead_task.wait();
+    const bool hit= ahead_offset == total_offset && buf.size() <= ahead_len;
+    ahead_len= 0;
+    if (hit)
+    {
+      memcpy(buf.data(), ahead_buf, buf.size());
+      return;
+    }
+  }
+
+  read_low(total_offset, buf);
+}
+
+void recv_sys_t::read_ahead_callback(void*)
+{
+  recv_sys.read_low(recv_sys.ahead_offset,
+                    {recv_sys.ahead_buf, recv_sys.ahead_len});
+}
+
+void recv_sys_t::read_ahead(os_offset_t offset, size_t len)
+{
+  ut_ad(len);
+  ut_ad(len <= RECV_SCAN_SIZE);
+  read_ahead_discard();
+  open_log_files_if_needed();
+
+  if (!ahead_buf)
+    ahead_buf= static_cast<byte*>(aligned_malloc(RECV_SCAN_SIZE,
+                                                 OS_FILE_LOG_BLOCK_SIZE));
+  ahead_offset= offset;
+  ahead_len= len;
+  srv_thread_pool->submit_task(&read_ahead_task);
+}
+
+void recv_sys_t::read_ahead_discard()
+{
+  if (ahead_len)
+  {
+    read_ahead_task.wait();
+    ahead_len= 0;
+  }
+}
+
 inline size_t recv_sys_t::files_size()
 {
   open_log_files_if_needed();
@@ -1232,6 +1279,13 @@ void recv_sys_t::close()
       buf= nullptr;
     }
 
+    read_ahead_discard();
+    if (ahead_buf)
+    {
+      aligned_free(ahead_buf);
+      ahead_buf= nullptr;
+    }
+
     last_stored_lsn= 0;
     mysql_mutex_destroy(&mutex);
     pthread_cond_destroy(&cond);
@@ -1267,6 +1321,7 @@ void recv_sys_t::create()
 	mlog_checkpoint_lsn = 0;
 
 	progress_time = time(NULL);
+	progress_pages = 0;
 	recv_max_page_lsn = 0;
 
 	memset(truncated_undo_spaces, 0, sizeof truncated_undo_spaces);
@@ -2746,9 +2801,16 @@ static void recv_recover_page(buf_block_t* block, mtr_t& mtr,
 	ut_ad(p->second.is_being_processed());
 	ut_ad(!recv_sys.pages.empty());
 
+	const time_t prev_time = recv_sys.progress_time;
+
 	if (recv_sys.report(now)) {
 		const ulint n = recv_sys.pages.size();
-		ib::info() << "To recover: " << n << " pages from log";
+		const ulint applied = recv_sys.progress_pages > n
+			? recv_sys.progress_pages - n : 0;
+		recv_sys.progress_pages = n;
+		ib::info() << "To recover: " << n << " pages from log ("
+			   << applied / ulint(now - prev_time)
+			   << " pages/s)";
 		service_manager_extend_timeout(
 			INNODB_EXTEND_TIMEOUT_INTERVAL, "To recover: " ULINTPF " pages from log", n);
 	}
@@ -2974,6 +3036,144 @@ inline fil_space_t *fil_system_t::find(const char *path) const
   return nullptr;
 }
 
+/** Recover the first pages of tablespaces whose creation was deferred,
+or discard the log for deleted ones, before apply_part() is invoked. */
+inline void recv_sys_t::apply_deferred()
+{
+  mysql_mutex_assert_owner(&mutex);
+  buf_block_t *free_block= nullptr;
+
+  for (auto d= deferred_spaces.defers.begin();
+       d != deferred_spaces.defers.end(); )
+  {
+    const uint32_t space_id= d->first;
+    map::iterator p= pages.lower_bound(page_id_t{space_id, 0});
+    if (p == pages.end() || p->first.space() != space_id)
+    {
+      d++;
+      continue;
+    }
+
+    if (!d->second.deleted)
+    {
+      if (!free_block)
+      {
+        mysql_mutex_unlock(&mutex);
+        free_block= buf_LRU_get_free_block(false);
+        mysql_mutex_lock(&mutex);
+        p= pages.lower_bound(page_id_t{space_id, 0});
+        if (p == pages.end() || p->first.space() != space_id)
+          continue;
+      }
+
+      const bool corrupted= recover_deferred(p, d->second.file_name,
+                                             free_block);
+      d= deferred_spaces.defers.erase(d);
+      if (!corrupted)
+        continue;
+      if (!srv_force_recovery)
+        set_corrupt_fs();
+      p= pages.lower_bound(page_id_t{space_id, 0});
+    }
+    else
+      /* For deleted files we must preserve the entry in deferred_spaces */
+      d++;
+
+    while (p != pages.end() && p->first.space() == space_id)
+    {
+      map::iterator r= p++;
+      r->second.log.clear();
+      pages.erase(r);
+    }
+  }
+
+  if (free_block)
+    buf_pool.free_block(free_block);
+}
+
+/** Apply buffered log to the pages of one partition of pages.
+The pages of each RECV_READ_AHEAD_AREA belong to the same partition.
+@param part     partition to process
+@param n_parts  number of partitions */
+void recv_sys_t::apply_part(unsigned part, unsigned n_parts)
+{
+  mysql_mutex_assert_owner(&mutex);
+  ut_ad(part < n_parts);
+  mtr_t mtr;
+  buf_block_t *free_block= nullptr;
+
+  for (map::iterator p= pages.begin(); p != pages.end(); )
+  {
+    const page_id_t page_id= p->first;
+    page_recv_t &recs= p->second;
+    ut_ad(!recs.log.empty());
+
+    if (n_parts > 1 &&
+        ut_fold_ulint_pair(page_id.space(),
+                           page_id.page_no() / RECV_READ_AHEAD_AREA) %
+        n_parts != part)
+    {
+      p++;
+      continue;
+    }
+
+    switch (recs.state) {
+    case page_recv_t::RECV_BEING_READ:
+    case page_recv_t::RECV_BEING_PROCESSED:
+      p++;
+      continue;
+    case page_recv_t::RECV_WILL_NOT_READ:
+      if (!free_block)
+        goto next_free_block;
+      if (UNIV_LIKELY(!!recover_low(page_id, p, mtr, free_block)))
+      {
+next_free_block:
+        mysql_mutex_unlock(&mutex);
+        free_block= buf_LRU_get_free_block(false);
+        mysql_mutex_lock(&mutex);
+next_page:
+        p= pages.lower_bound(page_id);
+      }
+      continue;
+    case page_recv_t::RECV_NOT_PROCESSED:
+      mtr.start();
+      mtr.set_log_mode(MTR_LOG_NO_REDO);
+      if (buf_block_t *block= buf_page_get_low(page_id, 0, RW_X_LATCH,
+                                               nullptr, BUF_GET_IF_IN_POOL,
+                                               &mtr, nullptr, false))
+      {
+        recv_recover_page(block, mtr, p);
+        ut_ad(mtr.has_committed());
+      }
+      else
+      {
+        mtr.commit();
+        recv_read_in_area(page_id);
+        break;
+      }
+      map::iterator r= p++;
+      r->second.log.clear();
+      pages.erase(r);
+      continue;
+    }
+
+    goto next_page;
+  }
+
+  if (free_block)
+    buf_pool.free_block(free_block);
+}
+
+/** Apply buffered log to a partition of recv_sys.pages.
+@param arg  partition number << 16 | number of partitions */
+static void recv_apply_task(void *arg)
+{
+  const size_t a= reinterpret_cast<size_t>(arg);
+  mysql_mutex_lock(&recv_sys.mutex);
+  recv_sys.apply_part(unsigned(a >> 16), unsigned(a & 0xffff));
+  mysql_mutex_unlock(&recv_sys.mutex);
+}
+
 /** Apply buffered log to persistent data pages.
 @param last_batch     whether it is possible to write more redo log */
 void recv_sys_t::apply(bool last_batch)
@@ -3037,87 +3237,40 @@ void recv_sys_t::apply(bool last_batch)
 
     fil_system.extend_to_recv_size();
 
-    buf_block_t *free_block= buf_LRU_get_free_block(false);
+    apply_deferred();
 
-    for (map::iterator p= pages.begin(); p != pages.end(); )
-    {
-      const page_id_t page_id= p->first;
-      page_recv_t &recs= p->second;
-      ut_ad(!recs.log.empty());
+    /* The pages that are read from data files will be recovered in
+    the I/O completion callbacks, whose concurrency is limited by
+    innodb_read_io_threads. Let equally many tasks process the rest. */
+    const unsigned n_parts= std::max(1U, unsigned(srv_n_read_io_threads));
+    progress_pages= n;
+    progress_time= time(nullptr);
 
-      const uint32_t space_id= page_id.space();
-      auto d= deferred_spaces.defers.find(space_id);
-      if (d != deferred_spaces.defers.end())
+    if (n_parts == 1)
+      apply_part(0, 1);
+    else
+    {
+      std::vector<tpool::waitable_task*> tasks;
+      tasks.reserve(n_parts - 1);
+      for (unsigned part= 1; part < n_parts; part++)
+        tasks.push_back(new tpool::waitable_task(recv_apply_task,
+                                                 reinterpret_cast<void*>
+                                                 (size_t{part} << 16 |
+                                                  n_parts)));
+      mysql_mutex_unlock(&mutex);
+      for (tpool::waitable_task *t : tasks)
+        srv_thread_pool->submit_task(t);
+      mysql_mutex_lock(&mutex);
+      apply_part(0, n_parts);
+      mysql_mutex_unlock(&mutex);
+      for (tpool::waitable_task *t : tasks)
       {
-        if (d->second.deleted)
-        {
-          /* For deleted files we must preserve the entry in deferred_spaces */
-erase_for_space:
-          while (p != pages.end() && p->first.space() == space_id)
-          {
-            map::iterator r= p++;
-            r->second.log.clear();
-            pages.erase(r);
-          }
-        }
-        else if (recover_deferred(p, d->second.file_name, free_block))
-        {
-          if (!srv_force_recovery)
-            set_corrupt_fs();
-          deferred_spaces.defers.erase(d);
-          goto erase_for_space;
-        }
-        else
-          deferred_spaces.defers.erase(d);
-        if (!free_block)
-          goto next_free_block;
-        p= pages.lower_bound(page_id);
-        continue;
-      }
-
-      switch (recs.state) {
-      case page_recv_t::RECV_BEING_READ:
-      case page_recv_t::RECV_BEING_PROCESSED:
-        p++;
-        continue;
-      case page_recv_t::RECV_WILL_NOT_READ:
-        if (UNIV_LIKELY(!!recover_low(page_id, p, mtr, free_block)))
-        {
-next_free_block:
-          mysql_mutex_unlock(&mutex);
-          free_block= buf_LRU_get_free_block(false);
-          mysql_mutex_lock(&mutex);
-next_page:
-          p= pages.lower_bound(page_id);
-        }
-        continue;
-      case page_recv_t::RECV_NOT_PROCESSED:
-        mtr.start();
-        mtr.set_log_mode(MTR_LOG_NO_REDO);
-        if (buf_block_t *block= buf_page_get_low(page_id, 0, RW_X_LATCH,
-                                                 nullptr, BUF_GET_IF_IN_POOL,
-                                                 &mtr, nullptr, false))
-        {
-          recv_recover_page(block, mtr, p);
-          ut_ad(mtr.has_committed());
-        }
-        else
-        {
-          mtr.commit();
-          recv_read_in_area(page_id);
-          break;
-        }
-        map::iterator r= p++;
-        r->second.log.clear();
-        pages.erase(r);
-        continue;
+        t->wait();
+        delete t;
       }
-
-      goto next_page;
+      mysql_mutex_lock(&mutex);
     }
 
-    buf_pool.free_block(free_block);
-
     /* Wait until all the pages have been processed */
     for (;;)
     {
@@ -3486,6 +3639,20 @@ static bool recv_scan_log_recs(
 	return(finished);
 }
 
+/** Initiate reading the redo log segment that starts at an LSN.
+@param lsn  start of the segment (aligned to OS_FILE_LOG_BLOCK_SIZE) */
+static void recv_read_ahead(lsn_t lsn)
+{
+  mysql_mutex_assert_owner(&log_sys.mutex);
+  ut_ad(!(lsn % OS_FILE_LOG_BLOCK_SIZE));
+  const lsn_t offset= log_sys.log.calc_lsn_offset_old(lsn);
+  /* Like log_t::file::read_log_seg(), do not read across a file boundary */
+  recv_sys.read_ahead(offset,
+                      size_t(std::min<lsn_t>(RECV_SCAN_SIZE,
+                                             log_sys.log.file_size -
+                                             offset % log_sys.log.file_size)));
+}
+
 /** Scans log from a buffer and stores new log data to the parsing buffer.
 Parses and hashes the log records if new data found.
 @param[in]	checkpoint_lsn		latest checkpoint log sequence number
@@ -3536,11 +3703,19 @@ recv_group_scan_log_recs(
 						 OS_FILE_LOG_BLOCK_SIZE);
 		end_lsn = start_lsn;
 		log_sys.log.read_log_seg(&end_lsn, start_lsn + RECV_SCAN_SIZE);
+
+		if (end_lsn == start_lsn + RECV_SCAN_SIZE) {
+			/* Read the next segment while this one is being
+			parsed. */
+			recv_read_ahead(end_lsn);
+		}
 	} while (end_lsn != start_lsn
 		 && !recv_scan_log_recs(&store, log_sys.buf, checkpoint_lsn,
 					start_lsn, end_lsn, contiguous_lsn,
 					&log_sys.log.scanned_lsn));
 
+	recv_sys.read_ahead_discard();
+
 	if (recv_sys.is_corrupt_log() || recv_sys.is_corrupt_fs()) {
 		DBUG_RETURN(false);
 	}
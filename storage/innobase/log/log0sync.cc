@@ -77,7 +77,6 @@ Note that if write operation is very fast, a) or b) can be fine as alternative.
 #include <log0types.h>
 #include "log0sync.h"
 #include <mysql/service_thd_wait.h>
-#include <sql_class.h>
 /**
   Helper class , used in group commit lock.
 
@@ -166,10 +165,22 @@ struct group_commit_waiter_t
 };
 
 group_commit_lock::group_commit_lock() :
-  m_mtx(), m_value(0), m_pending_value(0), m_lock(false), m_waiters_list()
+  m_mtx(), m_value(0), m_pending_value(0), m_lock(false), m_waiters_list(),
+  m_requests(0), m_batches(0), m_last_request(0), m_request_interval(0),
+  m_op_duration(0), m_op_start(0)
 {
 }
 
+/** Update a moving average with a new sample.
+@param avg     moving average
+@param sample  new sample */
+static inline void update_avg(std::atomic<ulonglong> &avg, ulonglong sample)
+{
+  /* The updates are not atomic, but these are only estimates. */
+  const ulonglong old= avg.load(std::memory_order_relaxed);
+  avg.store(old ? (old * 7 + sample) / 8 : sample, std::memory_order_relaxed);
+}
+
 group_commit_lock::value_type group_commit_lock::value() const
 {
   return m_value.load(std::memory_order::memory_order_relaxed);
@@ -187,6 +198,9 @@ void group_commit_lock::set_pending(group_commit_lock::value_type num)
 }
 
 const unsigned int MAX_SPINS = 1; /** max spins in acquire */
+/** lower limit of batch_delay(), in nanoseconds. A shorter sleep would
+be dominated by the timer slack of the kernel (50us by default). */
+const ulonglong MIN_BATCH_DELAY = 100000;
 thread_local group_commit_waiter_t thread_local_waiter;
 
 static inline void do_completion_callback(const completion_callback* cb)
@@ -199,6 +213,16 @@ group_commit_lock::lock_return_code group_commit_lock::acquire(value_type num, c
 {
   unsigned int spins = MAX_SPINS;
 
+  m_requests.fetch_add(1, std::memory_order_relaxed);
+  if (num > value())
+  {
+    const ulonglong now= my_interval_timer();
+    const ulonglong last= m_last_request.exchange(now,
+                                                  std::memory_order_relaxed);
+    if (last && now > last)
+      update_avg(m_request_interval, now - last);
+  }
+
   for(;;)
   {
     if (num <= value())
@@ -244,6 +268,7 @@ group_commit_lock::lock_return_code group_commit_lock::acquire(value_type num, c
 #ifndef DBUG_OFF
       m_owner_id = std::this_thread::get_id();
 #endif
+      m_op_start= my_interval_timer();
       if (callback)
         m_pending_callbacks.push_back({num,*callback});
       return lock_return_code::ACQUIRED;
@@ -279,6 +304,14 @@ void group_commit_lock::release(value_type num)
   completion_callback callbacks[1000];
   size_t callback_count = 0;
 
+  if (const ulonglong start= m_op_start)
+  {
+    const ulonglong now= my_interval_timer();
+    if (now > start)
+      update_avg(m_op_duration, now - start);
+  }
+  m_batches.fetch_add(1, std::memory_order_relaxed);
+
   std::unique_lock<std::mutex> lk(m_mtx);
   m_lock = false;
 
@@ -373,6 +406,34 @@ void group_commit_lock::release(value_type num)
   }
 }
 
+/**
+  Delay the operation of the lock owner, so that more requests can be
+  covered by it.
+
+  While the owner is waiting, any new requests will be queued.
+  The waiting only pays off if several requests are expected to arrive
+  during the window. We wait for at most half of the typical duration
+  of the operation and at most max_delay, and only if at least 2 requests
+  are expected to arrive during that time. Windows shorter than
+  MIN_BATCH_DELAY are skipped, because the sleep could take several
+  times longer than requested.
+
+  @param max_delay  upper limit of the delay, in nanoseconds
+*/
+void group_commit_lock::batch_delay(ulonglong max_delay)
+{
+  ut_ad(is_owner());
+  const ulonglong interval= m_request_interval.load(std::memory_order_relaxed);
+  const ulonglong window=
+    std::min(m_op_duration.load(std::memory_order_relaxed) / 2, max_delay);
+  if (interval && window >= MIN_BATCH_DELAY && window >= 2 * interval)
+  {
+    std::this_thread::sleep_for(std::chrono::nanoseconds(window));
+    /* Do not count the delay in the duration of the operation. */
+    m_op_start= my_interval_timer();
+  }
+}
+
 #ifndef DBUG_OFF
 bool group_commit_lock::is_owner()
 {
@@ -16,6 +16,7 @@ this program; if not, write to the Free Software Foundation, Inc.,
 *****************************************************************************/
 
 #include <atomic>
+#include <mutex>
 #include <thread>
 #include <log0types.h>
 #include <vector>
@@ -57,6 +58,19 @@ Operations supported on this semaphore
 - read pending value
 
 5. set_pending_value()
+
+6. batch_delay()
+- may be invoked by the lock owner right after acquire() returned
+  ACQUIRED, to delay the operation for a short adaptive window, so
+  that more requests can be covered by it. The window is derived from
+  the measured duration of the protected operation (for example, fsync)
+  and the measured interval between incoming requests, and it is limited
+  by the caller.
+
+7. requests(), batches()
+- statistics: number of acquire() calls, and number of operations
+  performed by lock owners. requests()/batches() is the average batch
+  size, requests() - batches() the number of operations saved.
 */
 class group_commit_lock
 {
@@ -73,6 +87,21 @@ class group_commit_lock
   typedef std::pair<value_type, completion_callback> pending_cb;
   std::vector<pending_cb> m_pending_callbacks;
 
+  /** number of acquire() calls */
+  std::atomic<size_t> m_requests;
+  /** number of times the lock was acquired and released */
+  std::atomic<size_t> m_batches;
+  /** time of the previous acquire() call, in nanoseconds */
+  std::atomic<ulonglong> m_last_request;
+  /** moving average of the interval between acquire() calls,
+  in nanoseconds */
+  std::atomic<ulonglong> m_request_interval;
+  /** moving average of the time between acquire() and release()
+  of the lock owner, excluding batch_delay(), in nanoseconds */
+  std::atomic<ulonglong> m_op_duration;
+  /** start time of the current operation of the lock owner */
+  ulonglong m_op_start;
+
 public:
   group_commit_lock();
   enum lock_return_code
@@ -86,6 +115,11 @@ class group_commit_lock
   value_type value() const;
   value_type pending() const;
   void set_pending(value_type num);
+  void batch_delay(ulonglong max_delay);
+  size_t requests() const
+  { return m_requests.load(std::memory_order_relaxed); }
+  size_t batches() const
+  { return m_batches.load(std::memory_order_relaxed); }
 #ifndef DBUG_OFF
   bool is_owner();
 #endif
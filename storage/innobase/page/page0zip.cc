@@ -3225,8 +3225,9 @@ page_zip_decompress(
 		mysql_mutex_unlock(&page_zip_stat_per_index_mutex);
 	}
 
-	/* Update the stat counter for LRU policy. */
+	/* Update the stat counters for LRU policy. */
 	buf_LRU_stat_inc_unzip();
+	buf_LRU_stat_add_unzip_us(ulint(time_diff));
 
 	MONITOR_INC(MONITOR_PAGE_DECOMPRESS);
 
@@ -172,13 +172,35 @@ For details see: row_vers_old_has_index_entry() and row_purge_poss_sec()
 */
 inline void ReadViewBase::snapshot(trx_t *trx)
 {
-  trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no);
-  std::sort(m_ids.begin(), m_ids.end());
+  if (trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no,
+                           &m_rw_trx_hash_erased))
+    srv_stats.n_read_views_reused.inc();
+  else
+    srv_stats.n_read_views_rebuilt.inc();
   m_up_limit_id= m_ids.empty() ? m_low_limit_id : m_ids.front();
   ut_ad(m_up_limit_id <= m_low_limit_id);
 }
 
 
+/**
+  Checks whether the snapshot would be the same if it was taken now.
+
+  A new transaction identifier or serialisation number could only have been
+  assigned if trx_sys.get_max_trx_id() changed. If the snapshot does not
+  include any active transactions, none of them can have been deregistered
+  since then.
+
+  trx_sys.get_rw_trx_hash_erased() must be loaded first, for the same reason
+  as in trx_sys_t::snapshot_ids().
+*/
+inline bool ReadViewBase::is_current() const
+{
+  const bool erased= !m_ids.empty() &&
+    m_rw_trx_hash_erased != trx_sys.get_rw_trx_hash_erased();
+  return !erased && m_low_limit_id == trx_sys.get_max_trx_id();
+}
+
+
 /**
   Opens a read view where exactly the transactions serialized before this
   point in time are seen in the view.
@@ -188,7 +210,8 @@ inline void ReadViewBase::snapshot(trx_t *trx)
   @param[in,out] trx transaction
 
   Reuses closed view if there were no read-write transactions since (and at)
-  its creation time.
+  its creation time, and none of the transactions that were active at its
+  creation time has been deregistered.
 
   Original comment states: there is an inherent race here between purge
   and this thread.
@@ -221,9 +244,11 @@ void ReadView::open(trx_t *trx)
   else if (likely(!srv_read_only_mode))
   {
     m_creator_trx_id= trx->id;
-    if (trx->is_autocommit_non_locking() && empty() &&
-        low_limit_id() == trx_sys.get_max_trx_id())
+    if (trx->is_autocommit_non_locking() && is_current())
+    {
+      srv_stats.n_read_views_reused.inc();
       m_open.store(true, std::memory_order_relaxed);
+    }
     else
     {
       mysql_mutex_lock(&m_mutex);
@@ -36,6 +36,7 @@ Created 4/20/1996 Heikki Tuuri
 #include "row0upd.h"
 #include "row0sel.h"
 #include "row0log.h"
+#include "row0merge.h"
 #include "rem0cmp.h"
 #include "lock0lock.h"
 #include "log0log.h"
@@ -2511,6 +2512,38 @@ extern "C" int thd_is_slave(const MYSQL_THD thd);
 # define thd_is_slave(thd) 0
 #endif
 
+/** Determine whether rows inserted into an empty table may be buffered
+and loaded with BtrBulk at handler::end_bulk_insert().
+@param[in]	thr	query thread
+@param[in]	index	clustered index
+@param[in]	entry	first clustered index entry to insert
+@return MySQL table handle, or NULL if rows must be inserted one by one */
+static TABLE*
+row_ins_bulk_buffer_table(
+	que_thr_t*		thr,
+	const dict_index_t&	index,
+	const dtuple_t&		entry)
+{
+	const que_node_t*	node = thr->run_node;
+
+	if (!node || que_node_get_type(node) != QUE_NODE_INSERT) {
+		return NULL;
+	}
+
+	TABLE*		table = static_cast<const ins_node_t*>(node)
+		->bulk_buffer_table;
+	const trx_t&	trx = *thr_get_trx(thr);
+
+	if (!table
+	    || trx.mod_tables.find(index.table) != trx.mod_tables.end()
+	    || !row_merge_bulk_t::is_supported(*index.table, trx)
+	    || !row_merge_bulk_t::can_buffer(index, entry)) {
+		return NULL;
+	}
+
+	return table;
+}
+
 /***************************************************************//**
 Tries to insert an entry into a clustered index, ignoring foreign key
 constraints. If a record with the same unique key is found, the other
@@ -2547,6 +2580,7 @@ row_ins_clust_index_entry_low(
 	rec_offs_init(offsets_);
 	trx_t*		trx	= thr_get_trx(thr);
 	buf_block_t*	block;
+	TABLE*		bulk_table	= NULL;
 
 	DBUG_ENTER("row_ins_clust_index_entry_low");
 
@@ -2634,7 +2668,11 @@ row_ins_clust_index_entry_low(
 	if (!(flags & BTR_NO_UNDO_LOG_FLAG)
 	    && page_is_empty(block->frame)
 	    && !entry->is_metadata() && !trx->duplicates
-	    && !trx->check_unique_secondary && !trx->check_foreigns
+	    /* Buffered rows are checked for duplicates when
+	    they are sorted at end_bulk_insert(). */
+	    && ((bulk_table = row_ins_bulk_buffer_table(
+			 thr, *index, *entry))
+		|| (!trx->check_unique_secondary && !trx->check_foreigns))
 	    && !trx->dict_operation
 	    && block->page.id().page_no() == index->page
 	    && !index->table->skip_alter_undo
@@ -2669,6 +2707,30 @@ row_ins_clust_index_entry_low(
 		}
 
 		trx->bulk_insert = true;
+
+		if (bulk_table) {
+			/* Write the TRX_UNDO_EMPTY record, and buffer
+			this and any subsequent rows of the statement. */
+			roll_ptr_t	roll_ptr;
+
+			ut_ad(!index->table->is_temporary());
+			err = trx_undo_report_row_operation(
+				thr, index, entry, NULL, 0, NULL, NULL,
+				&roll_ptr);
+
+			if (err == DB_SUCCESS) {
+				trx_mod_table_time_t& time
+					= trx->mod_tables.find(
+						index->table)->second;
+				ut_ad(time.is_bulk_insert());
+				time.bulk_store = new row_merge_bulk_t(
+					index->table);
+				err = time.bulk_store->add(
+					index, *entry, trx, bulk_table);
+			}
+
+			goto commit_exit;
+		}
 	}
 
 skip_bulk_insert:
@@ -3527,6 +3589,28 @@ row_ins_index_entry_step(
 
 	ut_ad(dtuple_check_typed(*node->entry));
 
+	if (!node->bulk_buffer_table) {
+	} else if (row_merge_bulk_t* bulk = thr_get_trx(thr)->bulk_buffer(
+			   *node->table)) {
+		trx_t*	trx = thr_get_trx(thr);
+
+		if (!node->index->is_primary()
+		    || row_merge_bulk_t::can_buffer(*node->index,
+						    **node->entry)) {
+			DBUG_RETURN(bulk->add(node->index, **node->entry,
+					      trx, node->bulk_buffer_table));
+		}
+
+		/* The row cannot be buffered. Load the buffered rows,
+		and insert this and any subsequent rows one by one. */
+		err = trx->bulk_insert_apply(*node->table,
+					     node->bulk_buffer_table);
+
+		if (err != DB_SUCCESS) {
+			DBUG_RETURN(err);
+		}
+	}
+
 	err = row_ins_index_entry(node->index, *node->entry, thr);
 
 	DEBUG_SYNC_C_IF_THD(thr_get_trx(thr)->mysql_thd,
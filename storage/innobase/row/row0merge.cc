@@ -264,6 +264,7 @@ or NULL if fd, block will be used instead
 @param[in,out]	stage		performance schema accounting object, used by
 ALTER TABLE. If not NULL stage->begin_phase_insert() will be called initially
 and then stage->inc() will be called for each record that is processed.
+@param[in]	foffs		offset of the first block of the run in fd
 @return DB_SUCCESS or error number */
 static	MY_ATTRIBUTE((warn_unused_result))
 dberr_t
@@ -281,7 +282,8 @@ row_merge_insert_index_tuples(
 					  */
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space,	   /*!< in: space id */
-	ut_stage_alter_t*	stage = NULL);
+	ut_stage_alter_t*	stage = NULL,
+	ulint			foffs = 0);
 
 /******************************************************//**
 Encode an index record. */
@@ -853,7 +855,7 @@ row_merge_dup_report(
 	row_merge_dup_t*	dup,	/*!< in/out: for reporting duplicates */
 	const dfield_t*		entry)	/*!< in: duplicate index entry */
 {
-	if (!dup->n_dup++) {
+	if (!dup->n_dup++ && dup->table) {
 		/* Only report the first duplicate record,
 		but count all duplicate records. */
 		innobase_fields_to_mysql(dup->table, dup->index, entry);
@@ -2851,11 +2853,25 @@ row_merge_read_clustered_index(
 }
 
 /** Write a record via buffer 2 and read the next record to buffer N.
+If split is not NULL, end the output run and start a new one after
+every split->n_rec records.
 @param N number of the buffer (0 or 1)
 @param INDEX record descriptor
 @param AT_END statement to execute at end of input */
 #define ROW_MERGE_WRITE_GET_NEXT_LOW(N, INDEX, AT_END)			\
 	do {								\
+		if (split && split->n < split->max			\
+		    && of->n_rec == split->n * split->n_rec) {		\
+			b2 = row_merge_write_eof(			\
+				&block[2 * srv_sort_buf_size],		\
+				b2, of->fd, &of->offset,		\
+			crypt_block ? &crypt_block[2 * srv_sort_buf_size] : NULL, \
+				space);					\
+			if (UNIV_UNLIKELY(!b2)) {			\
+				goto corrupt;				\
+			}						\
+			split->offset[split->n++] = of->offset;		\
+		}							\
 		b2 = row_merge_write_rec(&block[2 * srv_sort_buf_size], \
 					 &buf[2], b2,			\
 					 of->fd, &of->offset,		\
@@ -2905,6 +2921,7 @@ ALTER TABLE. If not NULL stage->inc() will be called for each record
 processed.
 @param[in,out]	crypt_block	encryption buffer
 @param[in]	space	tablespace ID for encryption
+@param[in,out]	split	how to partition the output, or NULL
 @return DB_SUCCESS or error code */
 static MY_ATTRIBUTE((warn_unused_result))
 dberr_t
@@ -2917,7 +2934,8 @@ row_merge_blocks(
 	merge_file_t*		of,
 	ut_stage_alter_t*	stage MY_ATTRIBUTE((unused)),
 	row_merge_block_t*	crypt_block,
-	ulint			space)
+	ulint			space,
+	row_merge_split_t*	split)
 {
 	mem_heap_t*	heap;	/*!< memory heap for offsets0, offsets1 */
 
@@ -3049,6 +3067,7 @@ row_merge_blocks_copy(
 	const mrec_t*	mrec0;	/*!< merge rec, points to block[0] */
 	rec_offs*	offsets0;/* offsets of mrec0 */
 	rec_offs*	offsets1;/* dummy offsets */
+	row_merge_split_t* const split = NULL;
 
 	DBUG_ENTER("row_merge_blocks_copy");
 	DBUG_LOG("ib_merge_sort",
@@ -3105,6 +3124,150 @@ row_merge_blocks_copy(
 		    != NULL);
 }
 
+/** Generate one run of a merge pass: merge the run i of the first half
+of the input with the run i of the second half, or copy the last run
+if the number of input runs is odd.
+@param[in]	dup		descriptor of index being created
+@param[in]	file		file containing index entries
+@param[in,out]	block		3 buffers
+@param[in]	num_run		number of runs in file
+@param[in]	run_offset	first offset number of each run in file
+@param[in]	i		number of the output run
+@param[in,out]	of		output file
+@param[in,out]	stage		performance schema accounting object, used by
+ALTER TABLE. If not NULL stage->inc() will be called for each record
+processed.
+@param[in,out]	crypt_block	encryption buffer
+@param[in]	space		tablespace ID for encryption
+@param[in,out]	split		how to partition the output, or NULL
+@return DB_SUCCESS or error code */
+static
+dberr_t
+row_merge_run(
+	const row_merge_dup_t*	dup,
+	const merge_file_t*	file,
+	row_merge_block_t*	block,
+	ulint			num_run,
+	const ulint*		run_offset,
+	ulint			i,
+	merge_file_t*		of,
+	ut_stage_alter_t*	stage,
+	row_merge_block_t*	crypt_block,
+	ulint			space,
+	row_merge_split_t*	split = NULL)
+{
+	const ulint	half	= num_run / 2;
+	ulint		foffs0	= run_offset[i];
+	ulint		foffs1	= run_offset[half + i];
+
+	if (i < half) {
+		return(row_merge_blocks(dup, file, block,
+					&foffs0, &foffs1, of, stage,
+					crypt_block, space, split));
+	}
+
+	ut_ad(!split);
+	ut_ad(i == half);
+	ut_ad(num_run & 1);
+
+	return(row_merge_blocks_copy(dup->index, file, block,
+				     &foffs1, of, stage,
+				     crypt_block, space)
+	       ? DB_SUCCESS : DB_CORRUPTION);
+}
+
+/** @return the number of blocks that a run of a merge file occupies
+@param[in]	file		file containing index entries
+@param[in]	num_run		number of runs in file
+@param[in]	run_offset	first offset number of each run in file
+@param[in]	i		number of the run */
+static
+ulint
+row_merge_run_size(
+	const merge_file_t*	file,
+	ulint			num_run,
+	const ulint*		run_offset,
+	ulint			i)
+{
+	return((i + 1 < num_run ? run_offset[i + 1] : file->offset)
+	       - run_offset[i]);
+}
+
+/** A merge pass that is being executed by several tasks */
+struct row_merge_pass_t {
+	trx_t*			trx;	/*!< transaction */
+	const row_merge_dup_t*	dup;	/*!< descriptor of index */
+	const merge_file_t*	file;	/*!< input file */
+	ulint			num_run;/*!< number of input runs */
+	const ulint*		run_offset;
+					/*!< first offset of each input run */
+	ulint*			out_offset;
+					/*!< first offset of each output run */
+	ulint			n_out;	/*!< number of output runs */
+	pfs_os_file_t		fd;	/*!< output file */
+	ulint			space;	/*!< tablespace ID for encryption */
+	std::atomic<ulint>	next;	/*!< next output run to generate */
+	std::atomic<ulint>	n_rec;	/*!< number of records written */
+	std::atomic<dberr_t>	error;	/*!< the first error, or DB_SUCCESS */
+	ulint			end;	/*!< end offset of the last output run */
+};
+
+/** A task that participates in row_merge_pass_t */
+struct row_merge_task_t {
+	row_merge_pass_t*	pass;	/*!< the merge pass */
+	row_merge_block_t*	block;	/*!< 3 buffers */
+	row_merge_block_t*	crypt_block;
+					/*!< encryption buffer, or NULL */
+	tpool::waitable_task*	task;	/*!< thread pool task, or NULL
+					for the task of the caller */
+};
+
+/** Generate output runs of a parallel merge pass until none remain.
+@param[in,out]	arg	row_merge_task_t */
+static void row_merge_pass_task(void* arg)
+{
+	row_merge_task_t*	t = static_cast<row_merge_task_t*>(arg);
+	row_merge_pass_t*	pass = t->pass;
+
+	for (;;) {
+		const ulint	i = pass->next.fetch_add(
+			1, std::memory_order_relaxed);
+
+		if (i >= pass->n_out
+		    || pass->error.load(std::memory_order_relaxed)
+		    != DB_SUCCESS) {
+			return;
+		}
+
+		dberr_t		err = DB_INTERRUPTED;
+		merge_file_t	of;
+		of.fd = pass->fd;
+		of.offset = pass->out_offset[i];
+		of.n_rec = 0;
+
+		if (!trx_is_interrupted(pass->trx)) {
+			err = row_merge_run(pass->dup, pass->file, t->block,
+					    pass->num_run, pass->run_offset,
+					    i, &of, NULL, t->crypt_block,
+					    pass->space);
+		}
+
+		if (err != DB_SUCCESS) {
+			dberr_t	success = DB_SUCCESS;
+			pass->error.compare_exchange_strong(success, err);
+			return;
+		}
+
+		ut_ad(i + 1 == pass->n_out
+		      || of.offset <= pass->out_offset[i + 1]);
+		pass->n_rec.fetch_add(of.n_rec, std::memory_order_relaxed);
+
+		if (i + 1 == pass->n_out) {
+			pass->end = of.offset;
+		}
+	}
+}
+
 /** Merge disk files.
 @param[in]	trx		transaction
 @param[in]	dup		descriptor of index being created
@@ -3115,10 +3278,15 @@ row_merge_blocks_copy(
 @param[in,out]	run_offset	Array that contains the first offset number
 for each merge run
 @param[in,out]	stage		performance schema accounting object, used by
-@param[in,out]	crypt_block	encryption buffer
-@param[in]	space		tablespace ID for encryption
 ALTER TABLE. If not NULL stage->inc() will be called for each record
 processed.
+@param[in,out]	crypt_block	encryption buffer
+@param[in]	space		tablespace ID for encryption
+@param[in,out]	tasks		additional tasks for generating the output
+runs in parallel
+@param[in]	n_tasks		number of elements in tasks
+@param[in,out]	split		how to partition the output of the last
+pass, or NULL
 @return DB_SUCCESS or error code */
 static
 dberr_t
@@ -3132,15 +3300,14 @@ row_merge(
 	ulint*			run_offset,
 	ut_stage_alter_t*	stage,
 	row_merge_block_t*	crypt_block,
-	ulint			space)
+	ulint			space,
+	row_merge_task_t*	tasks,
+	ulint			n_tasks,
+	row_merge_split_t*	split)
 {
-	ulint		foffs0;	/*!< first input offset */
-	ulint		foffs1;	/*!< second input offset */
 	dberr_t		error;	/*!< error code */
 	merge_file_t	of;	/*!< output file */
-	const ulint	ihalf	= run_offset[*num_run / 2];
-				/*!< half the input file */
-	ulint		n_run	= 0;
+	const ulint	n_out	= (*num_run + 1) / 2;
 				/*!< num of runs generated from this merge */
 
 	MEM_CHECK_ADDRESSABLE(&block[0], 3 * srv_sort_buf_size);
@@ -3149,7 +3316,7 @@ row_merge(
 		MEM_CHECK_ADDRESSABLE(&crypt_block[0], 3 * srv_sort_buf_size);
 	}
 
-	ut_ad(ihalf < file->offset);
+	ut_ad(run_offset[*num_run / 2] < file->offset);
 
 	of.fd = *tmpfd;
 	of.offset = 0;
@@ -3163,76 +3330,116 @@ row_merge(
 		      POSIX_FADV_SEQUENTIAL | POSIX_FADV_NOREUSE);
 #endif /* POSIX_FADV_SEQUENTIAL */
 
-	/* Merge blocks to the output file. */
-	foffs0 = 0;
-	foffs1 = ihalf;
+	if (n_tasks && n_out > 1) {
+		/* Each output run will be written to where the
+		corresponding input runs start in the input file. An
+		output run never occupies more blocks than its input,
+		but it may occupy fewer. The gaps that this leaves in
+		the output file will be skipped by the next pass,
+		because every run is addressed by run_offset[]. */
+		row_merge_pass_t	pass;
+		const ulint		half = *num_run / 2;
+		ulint			offset = 0;
+
+		pass.trx = trx;
+		pass.dup = dup;
+		pass.file = file;
+		pass.num_run = *num_run;
+		pass.run_offset = run_offset;
+		pass.out_offset = static_cast<ulint*>(
+			ut_malloc_nokey(n_out * sizeof *pass.out_offset));
+
+		if (UNIV_UNLIKELY(!pass.out_offset)) {
+			return(DB_OUT_OF_MEMORY);
+		}
+
+		pass.n_out = n_out;
+		pass.fd = of.fd;
+		pass.space = space;
+		pass.next = 0;
+		pass.n_rec = 0;
+		pass.error = DB_SUCCESS;
+		pass.end = 0;
+
+		for (ulint i = 0; i < n_out; i++) {
+			pass.out_offset[i] = offset;
+			offset += row_merge_run_size(file, *num_run,
+						     run_offset, half + i);
+			if (i < half) {
+				offset += row_merge_run_size(
+					file, *num_run, run_offset, i);
+			}
+		}
 
-	MEM_UNDEFINED(run_offset, *num_run * sizeof *run_offset);
+		ut_ad(offset == file->offset);
 
-	for (; foffs0 < ihalf && foffs1 < file->offset; foffs0++, foffs1++) {
+		const ulint	n = std::min(n_tasks, n_out - 1);
 
-		if (trx_is_interrupted(trx)) {
-			return(DB_INTERRUPTED);
+		for (ulint i = 0; i <= n; i++) {
+			tasks[i].pass = &pass;
 		}
 
-		/* Remember the offset number for this run */
-		run_offset[n_run++] = of.offset;
+		for (ulint i = 1; i <= n; i++) {
+			srv_thread_pool->submit_task(tasks[i].task);
+		}
 
-		error = row_merge_blocks(dup, file, block,
-					 &foffs0, &foffs1, &of, stage,
-					 crypt_block, space);
+		tasks[0].block = block;
+		tasks[0].crypt_block = crypt_block;
+		row_merge_pass_task(&tasks[0]);
 
-		if (error != DB_SUCCESS) {
-			return(error);
+		for (ulint i = 1; i <= n; i++) {
+			tasks[i].task->wait();
 		}
 
-	}
-
-	/* Copy the last blocks, if there are any. */
+		memcpy(run_offset, pass.out_offset,
+		       n_out * sizeof *run_offset);
+		ut_free(pass.out_offset);
 
-	while (foffs0 < ihalf) {
+		error = pass.error;
 
-		if (UNIV_UNLIKELY(trx_is_interrupted(trx))) {
-			return(DB_INTERRUPTED);
+		if (error != DB_SUCCESS) {
+			return(error);
 		}
 
-		/* Remember the offset number for this run */
-		run_offset[n_run++] = of.offset;
+		of.offset = pass.end;
+		of.n_rec = pass.n_rec;
 
-		if (!row_merge_blocks_copy(dup->index, file, block,
-					   &foffs0, &of, stage,
-					   crypt_block, space)) {
-			return(DB_CORRUPTION);
+#ifdef HAVE_PSI_STAGE_INTERFACE
+		if (stage != NULL) {
+			stage->inc(of.n_rec);
 		}
-	}
-
-	ut_ad(foffs0 == ihalf);
+#endif /* HAVE_PSI_STAGE_INTERFACE */
+	} else {
+		/* Merge blocks to the output file. The output run i
+		is written before run_offset[i] is overwritten, and
+		the input runs that remain to be read are located at
+		higher positions of run_offset[]. */
+		for (ulint i = 0; i < n_out; i++) {
+			if (UNIV_UNLIKELY(trx_is_interrupted(trx))) {
+				return(DB_INTERRUPTED);
+			}
 
-	while (foffs1 < file->offset) {
+			const ulint	offset = of.offset;
 
-		if (trx_is_interrupted(trx)) {
-			return(DB_INTERRUPTED);
-		}
+			error = row_merge_run(dup, file, block, *num_run,
+					      run_offset, i, &of, stage,
+					      crypt_block, space,
+					      n_out == 1 ? split : NULL);
 
-		/* Remember the offset number for this run */
-		run_offset[n_run++] = of.offset;
+			if (error != DB_SUCCESS) {
+				return(error);
+			}
 
-		if (!row_merge_blocks_copy(dup->index, file, block,
-					   &foffs1, &of, stage,
-					   crypt_block, space)) {
-			return(DB_CORRUPTION);
+			/* Remember the offset number for this run */
+			run_offset[i] = offset;
 		}
 	}
 
-	ut_ad(foffs1 == file->offset);
-
 	if (UNIV_UNLIKELY(of.n_rec != file->n_rec)) {
 		return(DB_CORRUPTION);
 	}
 
-	ut_ad(n_run <= *num_run);
-
-	*num_run = n_run;
+	*num_run = n_out;
 
 	/* Each run can contain one or more offsets. As merge goes on,
 	the number of runs (to merge) will reduce until we have one
@@ -3262,6 +3469,8 @@ row_merge(
 @param[in,out]	stage	performance schema accounting object, used by
 ALTER TABLE. If not NULL, stage->begin_phase_sort() will be called initially
 and then stage->inc() will be called for each record processed.
+@param[in]	n_threads	maximum number of threads for merging runs
+@param[in,out]	split	how to partition the sorted output, or NULL
 @return DB_SUCCESS or error code */
 dberr_t
 row_merge_sort(
@@ -3279,9 +3488,10 @@ row_merge_sort(
 	const double		pct_cost, /*!< in: current progress percent */
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space,	   /*!< in: space id */
-	ut_stage_alter_t* 	stage)
+	ut_stage_alter_t* 	stage,
+	ulint			n_threads,
+	row_merge_split_t*	split)
 {
-	const ulint	half	= file->offset / 2;
 	ulint		num_runs;
 	ulint*		run_offset;
 	dberr_t		error	= DB_SUCCESS;
@@ -3305,12 +3515,63 @@ row_merge_sort(
 
 	total_merge_sort_count = ulint(ceil(log2(double(num_runs))));
 
-	/* "run_offset" records each run's first offset number */
+	/* "run_offset" records each run's first offset number.
+	Initially, each block is a run. */
 	run_offset = (ulint*) ut_malloc_nokey(file->offset * sizeof(ulint));
 
-	/* This tells row_merge() where to start for the first round
-	of merge. */
-	run_offset[half] = half;
+	for (ulint i = 0; i < num_runs; i++) {
+		run_offset[i] = i;
+	}
+
+	/* Additional tasks for merging runs in parallel. The task 0
+	is executed by this thread, using block and crypt_block.
+	A unique index is merged by this thread only, because
+	cmp_rec_rec_simple() would report a duplicate in the
+	shared TABLE::record[0]. */
+	ulint			n_tasks = 0;
+	row_merge_task_t*	tasks = NULL;
+	row_merge_block_t*	task_blocks = NULL;
+	ut_new_pfx_t		task_pfx;
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	const ulint		block_size = 3 * srv_sort_buf_size;
+
+	if (n_threads > 1
+	    && !(dup->table && dict_index_is_unique(dup->index))) {
+		n_tasks = std::min(n_threads, (num_runs + 1) / 2) - 1;
+	}
+
+	if (n_tasks) {
+		task_blocks = alloc.allocate_large(
+			n_tasks * block_size * (crypt_block ? 2 : 1),
+			&task_pfx);
+
+		if (task_blocks == NULL) {
+			n_tasks = 0;
+		}
+	}
+
+	if (n_tasks) {
+		tasks = static_cast<row_merge_task_t*>(
+			ut_malloc_nokey((n_tasks + 1) * sizeof *tasks));
+
+		if (UNIV_UNLIKELY(!tasks)) {
+			alloc.deallocate_large(task_blocks, &task_pfx);
+			ut_free(run_offset);
+			DBUG_RETURN(DB_OUT_OF_MEMORY);
+		}
+
+		tasks[0].task = NULL;
+
+		for (ulint i = 1; i <= n_tasks; i++) {
+			row_merge_block_t*	b = task_blocks
+				+ (i - 1) * block_size * (crypt_block ? 2 : 1);
+			tasks[i].block = b;
+			tasks[i].crypt_block = crypt_block
+				? b + block_size : NULL;
+			tasks[i].task = new tpool::waitable_task(
+				row_merge_pass_task, &tasks[i]);
+		}
+	}
 
 	/* The file should always contain at least one byte (the end
 	of file marker).  Thus, it must be at least one block. */
@@ -3346,7 +3607,7 @@ row_merge_sort(
 
 		error = row_merge(trx, dup, file, block, tmpfd,
 				  &num_runs, run_offset, stage,
-				  crypt_block, space);
+				  crypt_block, space, tasks, n_tasks, split);
 
 		if(update_progress) {
 			merge_count++;
@@ -3367,6 +3628,15 @@ row_merge_sort(
 
 	ut_free(run_offset);
 
+	if (n_tasks) {
+		for (ulint i = 1; i <= n_tasks; i++) {
+			delete tasks[i].task;
+		}
+
+		ut_free(tasks);
+		alloc.deallocate_large(task_blocks, &task_pfx);
+	}
+
 	/* Progress report only for "normal" indexes. */
 #ifndef UNIV_SOLARIS
 	if (!(dup->index->type & DICT_FTS)) {
@@ -3473,6 +3743,7 @@ or NULL if fd, block will be used instead
 @param[in,out]	stage		performance schema accounting object, used by
 ALTER TABLE. If not NULL stage->begin_phase_insert() will be called initially
 and then stage->inc() will be called for each record that is processed.
+@param[in]	foffs		offset of the first block of the run in fd
 @return DB_SUCCESS or error number */
 static	MY_ATTRIBUTE((warn_unused_result))
 dberr_t
@@ -3490,13 +3761,13 @@ row_merge_insert_index_tuples(
 					  */
 	row_merge_block_t*	crypt_block, /*!< in: crypt buf or NULL */
 	ulint			space,	   /*!< in: space id */
-	ut_stage_alter_t*	stage)
+	ut_stage_alter_t*	stage,
+	ulint			foffs)
 {
 	const byte*		b;
 	mem_heap_t*		heap;
 	mem_heap_t*		tuple_heap;
 	dberr_t			error = DB_SUCCESS;
-	ulint			foffs = 0;
 	rec_offs*		offsets;
 	mrec_buf_t*		buf;
 	ulint			n_rows = 0;
@@ -3657,6 +3928,170 @@ row_merge_insert_index_tuples(
 	DBUG_RETURN(error);
 }
 
+/** Minimum number of records in each part of a parallel index load */
+static const ib_uint64_t ROW_MERGE_INSERT_PART_MIN_REC = 10000;
+
+/** A task that loads a part of the leaf level of an index */
+struct row_merge_insert_task_t {
+	dict_index_t*		index;	/*!< index being created */
+	const dict_table_t*	old_table;/*!< old table */
+	const merge_file_t*	file;	/*!< sorted index entries */
+	row_merge_block_t*	block;	/*!< file buffer */
+	row_merge_block_t*	crypt_block;
+					/*!< encryption buffer, or NULL */
+	ulint			space;	/*!< tablespace ID for encryption */
+	ulint			foffs;	/*!< first offset of the run */
+	ib_uint64_t		n_rec;	/*!< approximate number of records */
+	double			pct_progress;
+					/*!< total progress percent until now */
+	double			pct_cost;/*!< current progress percent */
+	BtrBulk*		btr_bulk;/*!< leaf-only bulk load */
+	dberr_t			error;	/*!< result of the load */
+	tpool::waitable_task*	task;	/*!< thread pool task, or NULL
+					for the task of the caller */
+};
+
+/** Load a part of the leaf level of an index.
+@param[in,out]	arg	row_merge_insert_task_t */
+static void row_merge_insert_task(void* arg)
+{
+	row_merge_insert_task_t*	t
+		= static_cast<row_merge_insert_task_t*>(arg);
+
+	t->error = row_merge_insert_index_tuples(
+		t->index, t->old_table, t->file->fd, t->block, NULL,
+		t->btr_bulk, t->n_rec, t->pct_progress, t->pct_cost,
+		t->crypt_block, t->space, NULL, t->foffs);
+	t->error = t->btr_bulk->finish(t->error);
+}
+
+/** Insert sorted index entries that were partitioned into several runs
+by row_merge_sort(). Each run is loaded into its own leaf pages by a
+separate task, and the node pointers are inserted afterwards.
+The tasks allocate their pages from the same leaf segment;
+PageBulk::init() serializes this by the tablespace latch and
+btr_page_alloc() by the SX latch on the root page.
+@param[in]	trx		transaction
+@param[in,out]	index		index being created
+@param[in]	old_table	old table
+@param[in]	file		sorted index entries
+@param[in]	split		the runs in file
+@param[in]	pct_progress	total progress percent until now
+@param[in]	pct_cost	current progress percent
+@param[in]	encrypt		whether the file is encrypted
+@param[in]	space		tablespace ID for encryption
+@param[in,out]	stage		performance schema accounting object, used by
+ALTER TABLE. If not NULL stage->begin_phase_insert() will be called initially
+and then stage->inc() will be called for each record that is processed.
+@return DB_SUCCESS or error code */
+static MY_ATTRIBUTE((warn_unused_result))
+dberr_t
+row_merge_insert_parallel(
+	const trx_t*		trx,
+	dict_index_t*		index,
+	const dict_table_t*	old_table,
+	const merge_file_t*	file,
+	const row_merge_split_t*split,
+	double			pct_progress,
+	double			pct_cost,
+	bool			encrypt,
+	ulint			space,
+	ut_stage_alter_t*	stage)
+{
+	const ulint	n = split->n;
+	ut_new_pfx_t	pfx;
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	const ulint	block_size = srv_sort_buf_size * (encrypt ? 2 : 1);
+
+	ut_ad(n > 1);
+	ut_ad(!dict_index_is_clust(index));
+
+	if (stage != NULL) {
+		stage->begin_phase_insert();
+	}
+
+	row_merge_block_t*	blocks = alloc.allocate_large(n * block_size,
+							      &pfx);
+	if (blocks == NULL) {
+		return(DB_OUT_OF_MEMORY);
+	}
+
+	row_merge_insert_task_t*	tasks
+		= static_cast<row_merge_insert_task_t*>(
+			ut_malloc_nokey(n * sizeof *tasks));
+
+	if (UNIV_UNLIKELY(!tasks)) {
+		alloc.deallocate_large(blocks, &pfx);
+		return(DB_OUT_OF_MEMORY);
+	}
+
+	for (ulint i = 0; i < n; i++) {
+		row_merge_insert_task_t&	t = tasks[i];
+		t.index = index;
+		t.old_table = old_table;
+		t.file = file;
+		t.block = blocks + i * block_size;
+		t.crypt_block = encrypt
+			? t.block + srv_sort_buf_size : NULL;
+		t.space = space;
+		t.foffs = split->offset[i];
+		t.n_rec = split->n_rec;
+		t.pct_progress = pct_progress;
+		t.pct_cost = pct_cost;
+		t.btr_bulk = UT_NEW_NOKEY(BtrBulk(index, trx, true));
+		t.error = DB_SUCCESS;
+		t.task = i ? new tpool::waitable_task(
+			row_merge_insert_task, &t) : NULL;
+	}
+
+	for (ulint i = 1; i < n; i++) {
+		srv_thread_pool->submit_task(tasks[i].task);
+	}
+
+	row_merge_insert_task(&tasks[0]);
+
+	dberr_t	error = tasks[0].error;
+
+	for (ulint i = 1; i < n; i++) {
+		tasks[i].task->wait();
+		delete tasks[i].task;
+
+		if (error == DB_SUCCESS) {
+			error = tasks[i].error;
+		}
+	}
+
+	alloc.deallocate_large(blocks, &pfx);
+
+	if (error == DB_SUCCESS) {
+		BtrBulk*	parts[64];
+		BtrBulk		btr_bulk(index, trx);
+
+		ut_ad(n <= array_elements(parts));
+
+		for (ulint i = 0; i < n; i++) {
+			parts[i] = tasks[i].btr_bulk;
+		}
+
+		error = btr_bulk.stitch(parts, n);
+		error = btr_bulk.finish(error);
+	}
+
+#ifdef HAVE_PSI_STAGE_INTERFACE
+	if (stage != NULL) {
+		stage->inc(ulint(file->n_rec));
+	}
+#endif /* HAVE_PSI_STAGE_INTERFACE */
+
+	for (ulint i = 0; i < n; i++) {
+		UT_DELETE(tasks[i].btr_bulk);
+	}
+
+	ut_free(tasks);
+
+	return(error);
+}
+
 /*********************************************************************//**
 Drop an index that was created before an error occurred.
 The data dictionary must have been locked exclusively by the caller,
@@ -4633,12 +5068,34 @@ row_merge_build_indexes(
 						      pct_cost);
 			}
 
+			/* The leaf level of a large secondary index is
+			loaded by several tasks from disjoint parts of the
+			sorted output. */
+			const ulint	n_threads
+				= thd_ddl_threads(trx->mysql_thd);
+			ulint		split_offset[64];
+			row_merge_split_t split = {
+				0, 1,
+				ulint(std::min<ib_uint64_t>(
+					      n_threads,
+					      merge_files[k].n_rec
+					      / ROW_MERGE_INSERT_PART_MIN_REC)),
+				split_offset};
+			split_offset[0] = 0;
+			ut_ad(n_threads <= array_elements(split_offset));
+
+			if (split.max > 1 && !dict_index_is_clust(sort_idx)) {
+				split.n_rec = (merge_files[k].n_rec
+					       + split.max - 1) / split.max;
+			}
+
 			error = row_merge_sort(
 					trx, &dup, &merge_files[k],
 					block, &tmpfd, true,
 					pct_progress, pct_cost,
 					crypt_block, new_table->space_id,
-					stage);
+					stage, n_threads,
+					split.n_rec ? &split : NULL);
 
 			pct_progress += pct_cost;
 
@@ -4652,8 +5109,6 @@ row_merge_build_indexes(
 			}
 
 			if (error == DB_SUCCESS) {
-				BtrBulk	btr_bulk(sort_idx, trx);
-
 				pct_cost = (COST_BUILD_INDEX_STATIC +
 					    (total_dynamic_cost
 					     * static_cast<double>(
@@ -4674,15 +5129,37 @@ row_merge_build_indexes(
 						n_indexes, pct_cost);
 				}
 
-				error = row_merge_insert_index_tuples(
-					sort_idx, old_table,
-					merge_files[k].fd, block, NULL,
-					&btr_bulk,
-					merge_files[k].n_rec, pct_progress, pct_cost,
-					crypt_block, new_table->space_id,
-					stage);
+				if (split.n > 1) {
+					if (global_system_variables.log_warnings
+					    > 2) {
+						sql_print_information(
+							"InnoDB: Online DDL :"
+							" Loading index %s"
+							" in " ULINTPF
+							" parts", buf,
+							split.n);
+					}
 
-				error = btr_bulk.finish(error);
+					error = row_merge_insert_parallel(
+						trx, sort_idx, old_table,
+						&merge_files[k], &split,
+						pct_progress, pct_cost,
+						crypt_block != NULL,
+						new_table->space_id, stage);
+				} else {
+					BtrBulk	btr_bulk(sort_idx, trx);
+
+					error = row_merge_insert_index_tuples(
+						sort_idx, old_table,
+						merge_files[k].fd, block, NULL,
+						&btr_bulk,
+						merge_files[k].n_rec,
+						pct_progress, pct_cost,
+						crypt_block,
+						new_table->space_id, stage);
+
+					error = btr_bulk.finish(error);
+				}
 
 				pct_progress += pct_cost;
 
@@ -4807,3 +5284,331 @@ row_merge_build_indexes(
 	DBUG_EXECUTE_IF("ib_index_crash_after_bulk_load", DBUG_SUICIDE(););
 	DBUG_RETURN(error);
 }
+
+/** Constructor
+@param[in]	table	table that is being inserted to */
+row_merge_bulk_t::row_merge_bulk_t(const dict_table_t* table)
+	: m_block(NULL), m_crypt_block(NULL), m_tmpfd(OS_FILE_CLOSED),
+	  m_autoinc(0), m_n_rows(0)
+{
+	for (dict_index_t* index = dict_table_get_first_index(table);
+	     index != NULL; index = dict_table_get_next_index(index)) {
+		index_buf_t	b;
+		b.index = index;
+		b.buf = NULL;
+		b.file.fd = OS_FILE_CLOSED;
+		b.file.offset = 0;
+		b.file.n_rec = 0;
+		m_bufs.push_back(b);
+	}
+}
+
+/** Destructor. Discards any buffered entries. */
+row_merge_bulk_t::~row_merge_bulk_t()
+{
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+
+	for (index_buf_t& b : m_bufs) {
+		if (b.buf) {
+			row_merge_buf_free(b.buf);
+		}
+		row_merge_file_destroy(&b.file);
+	}
+
+	row_merge_file_destroy_low(m_tmpfd);
+
+	if (m_block) {
+		alloc.deallocate_large(m_block, &m_block_pfx);
+	}
+
+	if (m_crypt_block) {
+		alloc.deallocate_large(m_crypt_block, &m_crypt_pfx);
+	}
+}
+
+/** @return whether rows inserted into an empty table can be
+buffered and loaded with BtrBulk
+@param[in]	table	the table
+@param[in]	trx	transaction */
+bool row_merge_bulk_t::is_supported(const dict_table_t& table,
+				    const trx_t& trx)
+{
+	if (table.is_temporary() || table.fts
+	    || table.skip_alter_undo
+	    || (trx.check_foreigns && !table.foreign_set.empty())) {
+		return false;
+	}
+
+	const dict_index_t* clust = dict_table_get_first_index(&table);
+
+	if (clust->is_instant() || dict_index_is_online_ddl(clust)) {
+		return false;
+	}
+
+	for (const dict_index_t* index = clust; index != NULL;
+	     index = dict_table_get_next_index(index)) {
+		if (!index->is_committed() || index->is_corrupted()
+		    || (index->type & (DICT_FTS | DICT_SPATIAL))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** @return whether a clustered index entry can be buffered
+@param[in]	index	clustered index
+@param[in]	entry	entry to insert */
+bool row_merge_bulk_t::can_buffer(const dict_index_t& index,
+				  const dtuple_t& entry)
+{
+	ut_ad(index.is_primary());
+
+	/* Off-page columns would have to be written to the
+	tablespace before the record is buffered. Such rows
+	are inserted one at a time. */
+	return !dtuple_get_n_ext(&entry)
+		&& !page_zip_rec_needs_ext(
+			rec_get_converted_size(
+				const_cast<dict_index_t*>(&index), &entry, 0),
+			index.table->not_redundant(),
+			dtuple_get_n_fields(&entry),
+			index.table->space->zip_size());
+}
+
+/** Allocate m_block and m_crypt_block if needed.
+@return whether the allocation succeeded */
+bool row_merge_bulk_t::alloc_block()
+{
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+
+	if (!m_block) {
+		m_block = alloc.allocate_large(3 * srv_sort_buf_size,
+					       &m_block_pfx);
+		if (!m_block) {
+			return false;
+		}
+	}
+
+	if (!m_crypt_block && log_tmp_is_encrypted()) {
+		m_crypt_block = alloc.allocate_large(3 * srv_sort_buf_size,
+						     &m_crypt_pfx);
+		if (!m_crypt_block) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** Sort the buffer of an index and write it to the temporary file.
+@param[in,out]	b	buffer of an index
+@param[in,out]	trx	transaction
+@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+@return error code */
+dberr_t
+row_merge_bulk_t::write_buf(index_buf_t& b, trx_t* trx, TABLE* table)
+{
+	row_merge_buf_t*	buf = b.buf;
+
+	if (!buf->n_tuples) {
+		return DB_SUCCESS;
+	}
+
+	if (dict_index_is_unique(buf->index)) {
+		row_merge_dup_t	dup = {buf->index, table, NULL, 0};
+
+		row_merge_buf_sort(buf, &dup);
+
+		if (dup.n_dup) {
+			trx->error_info = buf->index;
+			return DB_DUPLICATE_KEY;
+		}
+	} else {
+		row_merge_buf_sort(buf, NULL);
+	}
+
+	const char* path = thd_innodb_tmpdir(trx->mysql_thd);
+
+	if (!alloc_block()) {
+		return DB_OUT_OF_MEMORY;
+	}
+
+	if ((b.file.fd == OS_FILE_CLOSED
+	     && row_merge_file_create(&b.file, path) == OS_FILE_CLOSED)
+	    || !row_merge_tmpfile_if_needed(&m_tmpfd, path)) {
+		return DB_OUT_OF_MEMORY;
+	}
+
+	b.file.n_rec += buf->n_tuples;
+	row_merge_buf_write(buf, &b.file, m_block);
+
+	if (!row_merge_write(b.file.fd, b.file.offset++, m_block,
+			     m_crypt_block, b.index->table->space_id)) {
+		return DB_TEMP_FILE_WRITE_FAIL;
+	}
+
+	MEM_UNDEFINED(&m_block[0], srv_sort_buf_size);
+	b.buf = row_merge_buf_empty(buf);
+	return DB_SUCCESS;
+}
+
+/** Buffer an index entry.
+@param[in]	index	index of the entry
+@param[in]	entry	entry to insert
+@param[in,out]	trx	transaction
+@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+@return error code */
+dberr_t
+row_merge_bulk_t::add(const dict_index_t* index, const dtuple_t& entry,
+		      trx_t* trx, TABLE* table)
+{
+	index_buf_t*	b = NULL;
+
+	for (index_buf_t& i : m_bufs) {
+		if (i.index == index) {
+			b = &i;
+			break;
+		}
+	}
+
+	ut_ad(b);
+
+	if (!b->buf) {
+		b->buf = row_merge_buf_create(b->index);
+	}
+
+	const ulint	n_fields = dtuple_get_n_fields(&entry);
+	ut_ad(n_fields == dict_index_get_n_fields(index));
+
+	ulint	extra_size;
+	ulint	size = rec_get_converted_size_temp<false>(
+		index, entry.fields, n_fields, &extra_size);
+	/* The length of extra_size + 1 is encoded in 1 or 2 bytes. */
+	size += 1 + (extra_size + 1 >= 0x80);
+
+	if (b->buf->n_tuples >= b->buf->max_tuples
+	    || b->buf->total_size + size >= srv_sort_buf_size) {
+		if (dberr_t err = write_buf(*b, trx, table)) {
+			return err;
+		}
+	}
+
+	row_merge_buf_t*	buf = b->buf;
+	mtuple_t*		t = &buf->tuples[buf->n_tuples++];
+	t->fields = static_cast<dfield_t*>(
+		mem_heap_dup(buf->heap, entry.fields,
+			     n_fields * sizeof *t->fields));
+
+	for (ulint i = 0; i < n_fields; i++) {
+		dfield_dup(&t->fields[i], buf->heap);
+	}
+
+	buf->total_size += size;
+
+	if (index->is_primary()) {
+		m_n_rows++;
+		/* The rows are covered by the TRX_UNDO_EMPTY record,
+		like in btr_cur_ins_lock_and_undo(). */
+		memcpy(t->fields[index->db_trx_id()].data, reset_trx_id,
+		       DATA_TRX_ID_LEN);
+		memcpy(t->fields[index->db_roll_ptr()].data,
+		       reset_trx_id + DATA_TRX_ID_LEN, DATA_ROLL_PTR_LEN);
+
+		if (unsigned ai = index->table->persistent_autoinc) {
+			const dfield_t* dfield = &entry.fields[ai - 1];
+			if (!dfield_is_null(dfield)) {
+				m_autoinc = std::max(m_autoinc, row_parse_int(
+					static_cast<const byte*>(
+						dfield->data),
+					dfield->len, dfield->type.mtype,
+					dfield->type.prtype & DATA_UNSIGNED));
+			}
+		}
+	}
+
+	return DB_SUCCESS;
+}
+
+/** Load the index entries of an index.
+@param[in,out]	b	buffer of an index
+@param[in,out]	trx	transaction
+@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+@return error code */
+dberr_t
+row_merge_bulk_t::write_index(index_buf_t& b, trx_t* trx, TABLE* table)
+{
+	dict_index_t*	index = b.index;
+	const ulint	space = index->table->space_id;
+	dberr_t		err;
+	BtrBulk		btr_bulk(index, trx);
+
+	if (b.file.fd == OS_FILE_CLOSED) {
+		/* All entries fit in the sort buffer. */
+		if (dict_index_is_unique(index)) {
+			row_merge_dup_t	dup = {index, table, NULL, 0};
+
+			row_merge_buf_sort(b.buf, &dup);
+
+			if (dup.n_dup) {
+				trx->error_info = index;
+				return btr_bulk.finish(DB_DUPLICATE_KEY);
+			}
+		} else {
+			row_merge_buf_sort(b.buf, NULL);
+		}
+
+		err = row_merge_insert_index_tuples(
+			index, index->table, OS_FILE_CLOSED, NULL, b.buf,
+			&btr_bulk, 0, 0, 0, NULL, space);
+	} else {
+		row_merge_dup_t	dup = {index, table, NULL, 0};
+
+		err = write_buf(b, trx, table);
+
+		if (err == DB_SUCCESS) {
+			err = row_merge_sort(trx, &dup, &b.file, m_block,
+					     &m_tmpfd, false, 0, 0,
+					     m_crypt_block, space);
+		}
+
+		if (err == DB_DUPLICATE_KEY) {
+			trx->error_info = index;
+		} else if (err == DB_SUCCESS) {
+			err = row_merge_insert_index_tuples(
+				index, index->table, b.file.fd, m_block,
+				NULL, &btr_bulk, 0, 0, 0, m_crypt_block,
+				space);
+		}
+	}
+
+	return btr_bulk.finish(err);
+}
+
+/** Sort the buffered entries and load them into all indexes.
+@param[in,out]	trx	transaction
+@param[in,out]	table	MySQL table for reporting duplicates, or NULL
+@return error code */
+dberr_t row_merge_bulk_t::write_to_table(trx_t* trx, TABLE* table)
+{
+	for (index_buf_t& b : m_bufs) {
+		if (!b.buf) {
+			continue;
+		}
+
+		if (dberr_t err = write_index(b, trx, table)) {
+			return err;
+		}
+
+		row_merge_buf_free(b.buf);
+		b.buf = NULL;
+		row_merge_file_destroy(&b.file);
+
+		if (b.index->is_primary() && m_autoinc) {
+			btr_write_autoinc(b.index, m_autoinc);
+		}
+	}
+
+	srv_stats.n_rows_bulk_loaded.add(m_n_rows);
+	return DB_SUCCESS;
+}
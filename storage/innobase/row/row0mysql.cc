@@ -917,6 +917,8 @@ row_create_prebuilt(
 	prebuilt->fts_doc_id = 0;
 
 	prebuilt->mysql_row_len = mysql_row_len;
+	prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
+	prebuilt->ra_page_no = FIL_NULL;
 
 	prebuilt->fts_doc_id_in_read_set = 0;
 	prebuilt->blob_heap = NULL;
@@ -965,11 +967,13 @@ row_prebuilt_free(
 		mem_heap_free(prebuilt->old_vers_heap);
 	}
 
+	srv_stats.n_ra_pages_index_wasted.add(prebuilt->n_ra_pages);
+
 	if (prebuilt->fetch_cache[0] != NULL) {
 		byte*	base = prebuilt->fetch_cache[0] - 4;
 		byte*	ptr = base;
 
-		for (ulint i = 0; i < MYSQL_FETCH_CACHE_SIZE; i++) {
+		for (ulint i = 0; i < prebuilt->fetch_cache_alloc; i++) {
 			ulint	magic1 = mach_read_from_4(ptr);
 			ut_a(magic1 == ROW_PREBUILT_FETCH_MAGIC_N);
 			ptr += 4;
@@ -1310,6 +1314,8 @@ row_insert_for_mysql(
 
 	row_get_prebuilt_insert_row(prebuilt);
 	node = prebuilt->ins_node;
+	node->bulk_buffer_table = prebuilt->bulk_insert_buffer
+		? prebuilt->m_mysql_table : NULL;
 
 	row_mysql_convert_row_to_innobase(node->row, prebuilt, mysql_rec,
 					  &blob_heap);
@@ -52,6 +52,7 @@ Created 12/19/1997 Heikki Tuuri
 #include "pars0pars.h"
 #include "row0mysql.h"
 #include "buf0lru.h"
+#include "buf0rea.h"
 #include "srv0srv.h"
 #include "srv0mon.h"
 #ifdef WITH_WSREP
@@ -3835,11 +3836,14 @@ row_sel_prefetch_cache_init(
 	ulint	sz;
 	byte*	ptr;
 
+	ut_ad(prebuilt->fetch_cache_size <= UT_ARR_SIZE(prebuilt->fetch_cache));
+
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = prebuilt->fetch_cache_size * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
+	prebuilt->fetch_cache_alloc = prebuilt->fetch_cache_size;
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < prebuilt->fetch_cache_size; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3866,12 +3870,16 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
-	if (prebuilt->fetch_cache[0] == NULL) {
+	if (prebuilt->fetch_cache_alloc < prebuilt->fetch_cache_size) {
 		/* Allocate memory for the fetch cache */
 		ut_ad(prebuilt->n_fetch_cached == 0);
 
+		if (prebuilt->fetch_cache[0]) {
+			ut_free(prebuilt->fetch_cache[0] - 4);
+		}
+
 		row_sel_prefetch_cache_init(prebuilt);
 	}
 
@@ -3902,6 +3910,161 @@ row_sel_enqueue_cache_row_for_mysql(
 	++prebuilt->n_fetch_cached;
 }
 
+/** Double the number of rows to prefetch in the next batch if the rows
+fetched since positioning the cursor would have filled two batches. Long
+scans thus fetch larger batches, while a LIMIT or a short range will
+stop after reading at most twice the number of rows that were needed.
+@param[in,out]	prebuilt	prebuilt struct */
+static void row_sel_prefetch_cache_grow(row_prebuilt_t* prebuilt)
+{
+	ut_ad(!prebuilt->n_fetch_cached);
+
+	const ulint	size = prebuilt->fetch_cache_size * 2;
+
+	if (prebuilt->n_rows_fetched >= size * 2
+	    && size <= MYSQL_FETCH_CACHE_MAX
+	    && size * prebuilt->mysql_row_len <= MYSQL_FETCH_CACHE_BYTES) {
+		prebuilt->fetch_cache_size = size;
+	}
+}
+
+/** Forget the innodb_index_read_ahead state of a cursor that is being
+repositioned, and count the pages that the scan never entered as wasted.
+@param[in,out]	prebuilt	prebuilt struct */
+static void row_sel_read_ahead_reset(row_prebuilt_t* prebuilt)
+{
+	srv_stats.n_ra_pages_index_wasted.add(prebuilt->n_ra_pages);
+	prebuilt->ra_page_no = FIL_NULL;
+	prebuilt->n_ra_leaves = 0;
+	prebuilt->n_ra_ahead = 0;
+	prebuilt->n_ra_pages = 0;
+	prebuilt->ra_pending = false;
+}
+
+/** Note that an ascending scan entered a leaf page.
+If the page had been read by innodb_index_read_ahead, count it as useful.
+Request a read-ahead when the scan is about to run out of the pages
+that were looked up by the previous one.
+@param[in,out]	prebuilt	prebuilt struct
+@param[in]	page_no		the leaf page that the scan entered */
+static void row_sel_read_ahead_enter(row_prebuilt_t* prebuilt,
+				     uint32_t page_no)
+{
+	prebuilt->ra_page_no = page_no;
+
+	for (ulint i = 0; i < prebuilt->n_ra_pages; i++) {
+		if (prebuilt->ra_pages[i] != page_no) {
+			continue;
+		}
+
+		/* The pages are in key order. Any preceding ones
+		were freed or moved by a page merge or split. */
+		srv_stats.n_ra_pages_index_useful.inc();
+		srv_stats.n_ra_pages_index_wasted.add(i);
+		prebuilt->n_ra_pages -= i + 1;
+		memmove(prebuilt->ra_pages, prebuilt->ra_pages + i + 1,
+			prebuilt->n_ra_pages * sizeof *prebuilt->ra_pages);
+		break;
+	}
+
+	if (prebuilt->n_ra_ahead) {
+		prebuilt->n_ra_ahead--;
+	}
+
+	if (++prebuilt->n_ra_leaves >= MYSQL_READ_AHEAD_THRESHOLD
+	    && prebuilt->n_ra_ahead <= MYSQL_READ_AHEAD_PAGES / 4
+	    && srv_index_read_ahead) {
+		prebuilt->ra_pending = true;
+	}
+}
+
+/** Read ahead the leaf pages that follow the stored position of an
+ascending index scan (innodb_index_read_ahead). Unlike
+buf_read_ahead_linear(), which guesses from the access pattern within
+an extent, look up the node pointers that follow the current leaf page
+in its parent page, so that the reads cover exactly the pages that the
+scan is going to enter next, wherever they are in the tablespace.
+@param[in,out]	prebuilt	prebuilt struct
+@param[in]	pcur		persistent cursor whose position is stored */
+static void row_sel_read_ahead_index(row_prebuilt_t* prebuilt,
+				     const btr_pcur_t* pcur)
+{
+	dict_index_t*	index = pcur->btr_cur.index;
+
+	ut_ad(prebuilt->ra_pending);
+	ut_ad(!index->is_spatial());
+	prebuilt->ra_pending = false;
+
+	if (!pcur->old_stored || pcur->rel_pos == BTR_PCUR_AFTER_LAST_IN_TREE
+	    || pcur->rel_pos == BTR_PCUR_BEFORE_FIRST_IN_TREE
+	    || prebuilt->ra_page_no == index->page) {
+		/* The index consists of the root page only. */
+		return;
+	}
+
+	mem_heap_t*	heap = mem_heap_create(256);
+	dtuple_t*	tuple = dict_index_build_data_tuple(
+		pcur->old_rec, index, true, pcur->old_n_fields, heap);
+	rec_offs*	offsets = NULL;
+	uint32_t	pages[MYSQL_READ_AHEAD_PAGES];
+	ulint		n = 0;
+	page_cur_t	page_cur;
+	mtr_t		mtr;
+
+	mtr.start();
+
+	/* Dive to the parent of the leaf page, like a BTR_SEARCH_LEAF
+	search would, but check the level of every page on the way,
+	because the tree may have been shrunk to a single page since
+	the cursor position was stored. */
+	mtr_s_lock_index(index, &mtr);
+
+	for (buf_block_t* block = btr_root_block_get(index, RW_S_LATCH, &mtr);
+	     block && !page_is_leaf(block->frame); ) {
+		page_cur_search(block, index, tuple, PAGE_CUR_LE, &page_cur);
+
+		if (btr_page_get_level(block->frame) > 1) {
+			offsets = rec_get_offsets(
+				page_cur_get_rec(&page_cur), index, offsets,
+				0, ULINT_UNDEFINED, &heap);
+			block = btr_block_get(
+				*index, btr_node_ptr_get_child_page_no(
+					page_cur_get_rec(&page_cur), offsets),
+				RW_S_LATCH, false, &mtr);
+			continue;
+		}
+
+		/* Skip the node pointer to the current leaf page. */
+		for (page_cur_move_to_next(&page_cur);
+		     n < MYSQL_READ_AHEAD_PAGES
+		     && !page_cur_is_after_last(&page_cur);
+		     page_cur_move_to_next(&page_cur)) {
+			const rec_t*	rec = page_cur_get_rec(&page_cur);
+			offsets = rec_get_offsets(rec, index, offsets, 0,
+						  ULINT_UNDEFINED, &heap);
+			pages[n++] = btr_node_ptr_get_child_page_no(
+				rec, offsets);
+		}
+
+		break;
+	}
+
+	mtr.commit();
+	mem_heap_free(heap);
+
+	prebuilt->n_ra_ahead = n;
+
+	/* Pages that the previous read-ahead requested are in the buffer
+	pool by now and will not be requested again. */
+	ulint	n_issued = buf_read_ahead_pages(
+		index->table->space_id, pages,
+		std::min(n, MYSQL_READ_AHEAD_PAGES - prebuilt->n_ra_pages));
+
+	memcpy(prebuilt->ra_pages + prebuilt->n_ra_pages, pages,
+	       n_issued * sizeof *pages);
+	prebuilt->n_ra_pages += n_issued;
+}
+
 #ifdef BTR_CUR_HASH_ADAPT
 /*********************************************************************//**
 Tries to do a shortcut to fetch a clustered index record with a unique key,
@@ -4379,6 +4542,8 @@ row_search_mvcc(
 		prebuilt->n_rows_fetched = 0;
 		prebuilt->n_fetch_cached = 0;
 		prebuilt->fetch_cache_first = 0;
+		prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
+		row_sel_read_ahead_reset(prebuilt);
 
 		if (prebuilt->sel_graph == NULL) {
 			/* Build a dummy select query graph */
@@ -4403,6 +4568,8 @@ row_search_mvcc(
 			prebuilt->n_rows_fetched = 0;
 			prebuilt->n_fetch_cached = 0;
 			prebuilt->fetch_cache_first = 0;
+			prebuilt->fetch_cache_size = MYSQL_FETCH_CACHE_SIZE;
+			row_sel_read_ahead_reset(prebuilt);
 
 		} else if (UNIV_LIKELY(prebuilt->n_fetch_cached > 0)) {
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
@@ -4413,7 +4580,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_size) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -4429,6 +4597,8 @@ row_search_mvcc(
 			prebuilt->n_rows_fetched = 500000000;
 		}
 
+		row_sel_prefetch_cache_grow(prebuilt);
+
 		mode = pcur->search_mode;
 	}
 
@@ -4859,6 +5029,15 @@ row_search_mvcc(
 
 	rec = btr_pcur_get_rec(pcur);
 
+	if (moves_up && !spatial_search) {
+		const uint32_t page_no
+			= btr_pcur_get_block(pcur)->page.id().page_no();
+
+		if (page_no != prebuilt->ra_page_no) {
+			row_sel_read_ahead_enter(prebuilt, page_no);
+		}
+	}
+
 	if (!index->table->is_readable()) {
 		err = DB_DECRYPTION_FAILED;
 		goto page_read_error;
@@ -5571,7 +5750,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_cache_size);
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5623,7 +5802,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_cache_size) {
 			goto next_rec;
 		}
 
@@ -5878,6 +6057,10 @@ row_search_mvcc(
 normal_return:
 	mtr.commit();
 
+	if (prebuilt->ra_pending && err == DB_SUCCESS) {
+		row_sel_read_ahead_index(prebuilt, pcur);
+	}
+
 	DEBUG_SYNC_C("row_search_for_mysql_before_return");
 
 	if (prebuilt->pk_filter || prebuilt->idx_cond) {
@@ -5887,6 +6070,9 @@ row_search_mvcc(
 		to the record buffer that was passed in by MySQL. */
 
 		if (prebuilt->n_fetch_cached > 0) {
+			srv_stats.n_prefetch_batches.inc();
+			srv_stats.n_prefetch_rows.add(
+				prebuilt->n_fetch_cached);
 			row_sel_dequeue_cached_row_for_mysql(buf, prebuilt);
 			err = DB_SUCCESS;
 		}
@@ -5898,6 +6084,8 @@ row_search_mvcc(
 		buffer passed to use by MySQL. */
 
 		DEBUG_SYNC_C("row_search_cached_row");
+		srv_stats.n_prefetch_batches.inc();
+		srv_stats.n_prefetch_rows.add(1 + prebuilt->n_fetch_cached);
 		err = DB_SUCCESS;
 	}
 
@@ -2528,8 +2528,11 @@ row_upd_clust_rec(
 	mem_heap_t**	offsets_heap,
 				/*!< in/out: memory heap, can be emptied */
 	que_thr_t*	thr,	/*!< in: query thread */
-	mtr_t*		mtr)	/*!< in,out: mini-transaction; may be
+	mtr_t*		mtr,	/*!< in,out: mini-transaction; may be
 				committed and restarted here */
+	bool&		in_place)/*!< out: whether the record was updated
+				within the page, and pcur remains
+				positioned on it */
 {
 	mem_heap_t*	heap		= NULL;
 	big_rec_t*	big_rec		= NULL;
@@ -2571,7 +2574,9 @@ row_upd_clust_rec(
 			node->cmpl_info, thr, thr_get_trx(thr)->id, mtr);
 	}
 
-	if (err == DB_SUCCESS) {
+	in_place = err == DB_SUCCESS;
+
+	if (in_place) {
 		goto success;
 	}
 
@@ -2752,6 +2757,9 @@ row_upd_clust_step(
 	rec_offs*	offsets;
 	ulint		flags;
 	trx_t*		trx = thr_get_trx(thr);
+	/* Whether the explicit lock that was acquired by the caller
+	can be released after the record was modified */
+	bool		to_impl = false;
 
 	rec_offs_init(offsets_);
 
@@ -2827,7 +2835,21 @@ row_upd_clust_step(
 					  btr_pcur_get_block(pcur)->page.id(),
 					  page_rec_get_heap_no(rec)));
 
+	/* At READ COMMITTED or below, the explicit record lock that
+	row_search_mvcc() acquired before the update is redundant once
+	DB_TRX_ID carries our implicit lock. Dropping it keeps the
+	lock_sys hash cell of a hot page free for other transactions
+	until we commit. Only do this while pcur remains positioned on
+	the modified record. */
+	to_impl = !flags && node->has_clust_rec_x_lock
+		&& trx->isolation_level <= TRX_ISO_READ_COMMITTED;
+
 	if (node->is_delete == PLAIN_DELETE) {
+		to_impl = to_impl && !referenced
+#ifdef WITH_WSREP
+			&& !foreign
+#endif
+			;
 		err = row_upd_del_mark_clust_rec(
 			node, index, offsets, thr, referenced,
 #ifdef WITH_WSREP
@@ -2849,8 +2871,13 @@ row_upd_clust_step(
 	}
 
 	if (!node->is_delete && node->cmpl_info & UPD_NODE_NO_ORD_CHANGE) {
+		bool	in_place;
 		err = row_upd_clust_rec(
-			flags, node, index, offsets, &heap, thr, &mtr);
+			flags, node, index, offsets, &heap, thr, &mtr,
+			in_place);
+		/* After btr_cur_pessimistic_update(), the page may
+		have been merged and pcur may be invalid. */
+		to_impl = to_impl && in_place;
 		goto exit_func;
 	}
 
@@ -2874,6 +2901,7 @@ row_upd_clust_step(
 		choosing records to update. MySQL solves now the problem
 		externally! */
 
+		to_impl = false;
 		err = row_upd_clust_rec_by_insert(
 			node, index, thr, referenced,
 #ifdef WITH_WSREP
@@ -2887,8 +2915,11 @@ row_upd_clust_step(
 			node->index = dict_table_get_next_index(index);
 		}
 	} else {
+		bool	in_place;
 		err = row_upd_clust_rec(
-			flags, node, index, offsets, &heap, thr, &mtr);
+			flags, node, index, offsets, &heap, thr, &mtr,
+			in_place);
+		to_impl = to_impl && in_place;
 
 		if (err == DB_SUCCESS) {
 			ut_ad(node->is_delete != PLAIN_DELETE);
@@ -2900,6 +2931,10 @@ row_upd_clust_step(
 	}
 
 exit_func:
+	if (to_impl && err == DB_SUCCESS) {
+		lock_clust_rec_release_to_impl(*btr_pcur_get_block(pcur),
+					       btr_pcur_get_rec(pcur), trx);
+	}
 	mtr.commit();
 	if (UNIV_LIKELY_NULL(heap)) {
 		mem_heap_free(heap);
@@ -44,6 +44,7 @@ Created 10/8/1995 Heikki Tuuri
 #include "mysql/psi/psi.h"
 
 #include "btr0sea.h"
+#include "buf0dump.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
 #include "dict0boot.h"
@@ -139,6 +140,8 @@ use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
 my_bool	srv_numa_interleave;
+/** innodb_numa_local */
+my_bool	srv_numa_local;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
 /** innodb_compression_algorithm; used with page compression */
@@ -163,6 +166,8 @@ ulong		srv_log_buffer_size;
 ulong		srv_flush_log_at_trx_commit;
 /** innodb_flush_log_at_timeout */
 uint		srv_flush_log_at_timeout;
+/** innodb_log_group_commit_delay, in microseconds */
+uint		srv_log_group_commit_delay;
 /** innodb_page_size */
 ulong		srv_page_size;
 /** log2 of innodb_page_size; @see innodb_init_params() */
@@ -209,6 +214,9 @@ ulint	srv_buf_pool_base_size;
 ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 ulong	srv_buf_pool_dump_pct;
+/** innodb_buffer_pool_dump_interval: seconds between periodic
+buffer pool dumps, or 0 to only dump on request and at shutdown */
+uint	srv_buf_pool_dump_interval;
 /** Abort load after this amount of pages */
 #ifdef UNIV_DEBUG
 ulong srv_buf_pool_load_pages_abort = LONG_MAX;
@@ -226,6 +234,8 @@ uint	srv_n_write_io_threads;
 
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
+/** innodb_index_read_ahead */
+my_bool	srv_index_read_ahead;
 /** innodb_read_ahead_threshold; the number of pages that must be present
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
@@ -971,6 +981,7 @@ srv_export_innodb_status(void)
 #ifdef BTR_CUR_HASH_ADAPT
 	export_vars.innodb_ahi_hit = btr_cur_n_sea;
 	export_vars.innodb_ahi_miss = btr_cur_n_non_sea;
+	export_vars.innodb_ahi_latch_fail = btr_search_n_latch_fail;
 
 	ulint mem_adaptive_hash = 0;
 	for (ulong i = 0; i < btr_ahi_parts; i++) {
@@ -1021,6 +1032,12 @@ srv_export_innodb_status(void)
 
 	export_vars.innodb_data_written = srv_stats.data_written + dblwr;
 
+	export_vars.innodb_data_write_avg_bytes
+		= export_vars.innodb_data_writes
+		? export_vars.innodb_data_written
+		/ export_vars.innodb_data_writes
+		: 0;
+
 	export_vars.innodb_buffer_pool_read_requests
 		= buf_pool.stat.n_page_gets;
 
@@ -1038,6 +1055,15 @@ srv_export_innodb_status(void)
 	export_vars.innodb_buffer_pool_read_ahead_evicted =
 		buf_pool.stat.n_ra_pages_evicted;
 
+	export_vars.innodb_buffer_pool_read_ahead_index =
+		srv_stats.n_ra_pages_read_index;
+
+	export_vars.innodb_buffer_pool_read_ahead_index_useful =
+		srv_stats.n_ra_pages_index_useful;
+
+	export_vars.innodb_buffer_pool_read_ahead_index_wasted =
+		srv_stats.n_ra_pages_index_wasted;
+
 	export_vars.innodb_buffer_pool_pages_data =
 		UT_LIST_GET_LEN(buf_pool.LRU);
 
@@ -1082,6 +1108,14 @@ srv_export_innodb_status(void)
 
 	export_vars.innodb_os_log_fsyncs = log_sys.get_flushes();
 
+	{
+		size_t requests, batches;
+		log_flush_batch_stats(&requests, &batches);
+		export_vars.innodb_os_log_fsync_batch_avg
+			= batches ? requests / batches : 0;
+		export_vars.innodb_os_log_fsyncs_saved = requests - batches;
+	}
+
 	export_vars.innodb_os_log_pending_fsyncs
 		= log_sys.get_pending_flushes();
 
@@ -1110,12 +1144,24 @@ srv_export_innodb_status(void)
 
 	export_vars.innodb_rows_read = srv_stats.n_rows_read;
 
+	export_vars.innodb_row_prefetch_batches
+		= srv_stats.n_prefetch_batches;
+
+	export_vars.innodb_row_prefetch_rows = srv_stats.n_prefetch_rows;
+
 	export_vars.innodb_rows_inserted = srv_stats.n_rows_inserted;
 
+	export_vars.innodb_rows_bulk_loaded = srv_stats.n_rows_bulk_loaded;
+
 	export_vars.innodb_rows_updated = srv_stats.n_rows_updated;
 
 	export_vars.innodb_rows_deleted = srv_stats.n_rows_deleted;
 
+	export_vars.innodb_read_views_reused = srv_stats.n_read_views_reused;
+
+	export_vars.innodb_read_views_rebuilt
+		= srv_stats.n_read_views_rebuilt;
+
 	export_vars.innodb_system_rows_read = srv_stats.n_system_rows_read;
 
 	export_vars.innodb_system_rows_inserted =
@@ -1175,6 +1221,10 @@ srv_export_innodb_status(void)
 			crypt_stat.pages_flushed;
 		export_vars.innodb_encryption_rotation_estimated_iops =
 			crypt_stat.estimated_iops;
+		export_vars.innodb_encryption_rotation_pages_per_second =
+			crypt_stat.pages_per_second;
+		export_vars.innodb_encryption_rotation_allowed_iops =
+			crypt_stat.allowed_iops;
 		export_vars.innodb_encryption_key_requests =
 			srv_stats.n_key_requests;
 		export_vars.innodb_key_rotation_list_length =
@@ -1702,6 +1752,7 @@ void srv_master_callback(void*)
 	} else {
 		srv_master_do_idle_tasks();
 	}
+	buf_dump_if_due();
 	srv_main_thread_op_info = "sleeping";
 }
 
@@ -1799,6 +1850,8 @@ static uint32_t srv_do_purge(ulint* n_total_purged)
 	}
 
 	do {
+		const uint32_t history = trx_sys.history_size_approx();
+
 		if (UNIV_UNLIKELY(srv_purge_thread_count_changed)) {
 			/* Read the fresh value of srv_n_purge_threads, reset
 			the changed flag. Both variables are protected by
@@ -1812,13 +1865,19 @@ static uint32_t srv_do_purge(ulint* n_total_purged)
 			std::lock_guard<std::mutex> lk(purge_thread_count_mtx);
 			n_threads = n_use_threads = srv_n_purge_threads;
 			srv_purge_thread_count_changed = 0;
-		} else if (trx_sys.history_size_approx() > rseg_history_len
-			   || (srv_max_purge_lag > 0
-			       && rseg_history_len > srv_max_purge_lag)) {
+		} else if (srv_max_purge_lag > 0
+			   && rseg_history_len > srv_max_purge_lag) {
+			/* DML is being delayed by trx_purge_dml_delay().
+			Use all threads. */
+			n_use_threads = n_threads;
+		} else if (history > rseg_history_len) {
 			/* History length is now longer than what it was
-			when we took the last snapshot. Use more threads. */
+			when we took the last snapshot. Use more threads,
+			all of them if the history length has doubled. */
 
-			if (n_use_threads < n_threads) {
+			if (history / 2 > rseg_history_len) {
+				n_use_threads = n_threads;
+			} else if (n_use_threads < n_threads) {
 				++n_use_threads;
 			}
 
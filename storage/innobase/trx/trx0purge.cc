@@ -42,6 +42,8 @@ Created 3/26/1996 Heikki Tuuri
 #include "trx0trx.h"
 #include <mysql/service_wsrep.h>
 
+#include <algorithm>
+#include <bitset>
 #include <unordered_map>
 
 #ifdef UNIV_PFS_RWLOCK
@@ -176,6 +178,7 @@ void purge_sys_t::create()
   hdr_offset= 0;
   latch.SRW_LOCK_INIT(trx_purge_latch_key);
   mysql_mutex_init(purge_sys_pq_mutex_key, &pq_mutex, nullptr);
+  stats_mutex.init();
   truncate.current= NULL;
   truncate.last= NULL;
   heap= mem_heap_create(4096);
@@ -197,6 +200,9 @@ void purge_sys_t::close()
   trx->free();
   latch.destroy();
   mysql_mutex_destroy(&pq_mutex);
+  stats_mutex.destroy();
+  batch_tables.clear();
+  batch_tables.shrink_to_fit();
   mem_heap_free(heap);
   heap= nullptr;
 }
@@ -1065,6 +1071,112 @@ trx_purge_fetch_next_rec(
 	return(trx_purge_get_next_rec(n_pages_handled, heap));
 }
 
+/** Determine how the first PRIMARY KEY column of a table can be folded
+by trx_purge_rec_fold(), so that keys that compare equal are assigned
+to the same purge task.
+@param id	table identifier
+@param cs	collation of the column, or nullptr to fold the bytes
+@return whether the records of the table may be distributed by key */
+static bool trx_purge_fold_cs(table_id_t id, const CHARSET_INFO*& cs)
+{
+	ulint	mtype = DATA_MISSING;
+	ulint	prtype = 0;
+
+	dict_sys.mutex_lock();
+	if (const dict_table_t* table = dict_sys.find_table(id)) {
+		if (const dict_index_t* index
+		    = dict_table_get_first_index(table)) {
+			mtype = index->fields[0].col->mtype;
+			prtype = index->fields[0].col->prtype;
+		}
+	}
+	dict_sys.mutex_unlock();
+
+	cs = nullptr;
+
+	switch (mtype) {
+	case DATA_INT:
+	case DATA_SYS:
+	case DATA_SYS_CHILD:
+		return true;
+	case DATA_FIXBINARY:
+	case DATA_BINARY:
+		return dtype_get_charset_coll(prtype)
+			== DATA_MYSQL_BINARY_CHARSET_COLL;
+	case DATA_BLOB:
+		if (prtype & DATA_BINARY_TYPE) {
+			return true;
+		}
+		/* fall through */
+	case DATA_MYSQL:
+	case DATA_VARMYSQL:
+		cs = get_charset(uint(dtype_get_charset_coll(prtype)),
+				 MYF(0));
+		return cs != nullptr;
+	case DATA_CHAR:
+	case DATA_VARCHAR:
+		cs = &my_charset_latin1;
+		return true;
+	}
+
+	/* The table was not found, or equal values of the column
+	(such as DECIMAL, or -0.0 and 0.0) may differ in their bytes. */
+	return false;
+}
+
+/** Compute a hash value of the first PRIMARY KEY column in an undo log
+record, so that all undo log records of a row are assigned to the same
+purge task, and will be processed in order.
+@param undo_rec	undo log record
+@param cs	collation of the column, or nullptr to fold the bytes
+@return hash value */
+static ulint trx_purge_rec_fold(trx_undo_rec_t *undo_rec,
+				const CHARSET_INFO *cs)
+{
+	ulint		type;
+	ulint		cmpl_info;
+	bool		updated_extern;
+	undo_no_t	undo_no;
+	table_id_t	table_id;
+	const byte*	ptr = trx_undo_rec_get_pars(
+		undo_rec, &type, &cmpl_info, &updated_extern,
+		&undo_no, &table_id);
+
+	switch (type) {
+	case TRX_UNDO_INSERT_REC:
+		break;
+	case TRX_UNDO_UPD_EXIST_REC:
+	case TRX_UNDO_UPD_DEL_REC:
+	case TRX_UNDO_DEL_MARK_REC:
+		trx_id_t	trx_id;
+		roll_ptr_t	roll_ptr;
+		byte		info_bits;
+		ptr = trx_undo_update_rec_get_sys_cols(
+			ptr, &trx_id, &roll_ptr, &info_bits);
+		break;
+	default:
+		/* The record does not refer to a particular row. */
+		return 0;
+	}
+
+	const byte*	field;
+	uint32_t	len;
+	uint32_t	orig_len;
+	trx_undo_rec_get_col_val(ptr, &field, &len, &orig_len);
+
+	if (len >= UNIV_EXTERN_STORAGE_FIELD) {
+		return 0;
+	}
+
+	if (!cs) {
+		return ut_fold_binary(field, len);
+	}
+
+	ulong	nr1 = 1, nr2 = 4;
+	cs->hash_sort(field, len, &nr1, &nr2);
+	return nr1;
+}
+
 /** Run a purge batch.
 @param n_purge_threads	number of purge threads
 @return number of undo log pages handled in the batch */
@@ -1073,58 +1185,66 @@ ulint
 trx_purge_attach_undo_recs(ulint n_purge_threads)
 {
 	que_thr_t*	thr;
-	ulint		i;
 	ulint		n_pages_handled = 0;
 	ulint		n_thrs = UT_LIST_GET_LEN(purge_sys.query->thrs);
 
 	ut_a(n_purge_threads > 0);
+	ut_a(n_purge_threads <= innodb_purge_threads_MAX);
 
 	purge_sys.head = purge_sys.tail;
 
-#ifdef UNIV_DEBUG
-	i = 0;
-	/* Debug code to validate some pre-requisites and reset done flag. */
+	std::vector<purge_node_t*> nodes;
+	nodes.reserve(n_purge_threads);
+
 	for (thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-	     thr != NULL && i < n_purge_threads;
-	     thr = UT_LIST_GET_NEXT(thrs, thr), ++i) {
+	     thr != NULL && nodes.size() < n_purge_threads;
+	     thr = UT_LIST_GET_NEXT(thrs, thr)) {
 
 		purge_node_t*		node;
 
 		/* Get the purge node. */
 		node = (purge_node_t*) thr->child;
 
-		ut_ad(que_node_get_type(node) == QUE_NODE_PURGE);
+		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
 		ut_ad(node->undo_recs.empty());
 		ut_ad(!node->in_progress);
 		ut_d(node->in_progress = true);
+		nodes.push_back(node);
 	}
 
 	/* There should never be fewer nodes than threads, the inverse
 	however is allowed because we only use purge threads as needed. */
-	ut_ad(i == n_purge_threads);
-#endif
-
-	/* Fetch and parse the UNDO records. The UNDO records are added
-	to a per purge node vector. */
-	thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-	ut_a(n_thrs > 0 && thr != NULL);
+	ut_a(n_thrs > 0 && nodes.size() == n_purge_threads);
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
 
-	i = 0;
+	/* The work on one table in the batch */
+	struct table_work
+	{
+		/** number of undo log records */
+		ulint		n_recs;
+		/** trx_t::no of the first undo log record */
+		trx_id_t	trx_no;
+		/** the task that all records are assigned to,
+		or ULINT_UNDEFINED if the records are distributed
+		to all tasks by trx_purge_rec_fold() */
+		ulint		task;
+		/** bitmap of the tasks that records were assigned to */
+		uint32_t	tasks;
+		/** collation of the first PRIMARY KEY column
+		if task == ULINT_UNDEFINED */
+		const CHARSET_INFO*	cs;
+	};
 
 	const ulint		batch_size = srv_purge_batch_size;
-	std::unordered_map<table_id_t, purge_node_t*> table_id_map;
+	std::unordered_map<table_id_t, table_work> tables;
+	std::vector<std::pair<trx_purge_rec_t, table_work*> > recs;
 	mem_heap_empty(purge_sys.heap);
 
+	/* Fetch and parse the UNDO records. */
 	while (UNIV_LIKELY(srv_undo_sources) || !srv_fast_shutdown) {
-		purge_node_t*		node;
 		trx_purge_rec_t		purge_rec;
 
-		/* Get the purge node. */
-		node = (purge_node_t*) thr->child;
-		ut_a(que_node_get_type(node) == QUE_NODE_PURGE);
-
 		/* Track the max {trx_id, undo_no} for truncating the
 		UNDO logs once we have purged the records. */
 
@@ -1132,6 +1252,8 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 			purge_sys.head = purge_sys.tail;
 		}
 
+		const trx_id_t trx_no = purge_sys.tail.trx_no;
+
 		/* Fetch the next record, and advance the purge_sys.tail. */
 		purge_rec.undo_rec = trx_purge_fetch_next_rec(
 			&purge_rec.roll_ptr, &n_pages_handled,
@@ -1143,26 +1265,14 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 			continue;
 		}
 
-		table_id_t table_id = trx_undo_rec_get_table_id(
-			purge_rec.undo_rec);
-
-		purge_node_t *& table_node = table_id_map[table_id];
+		table_work& table = tables[trx_undo_rec_get_table_id(
+						   purge_rec.undo_rec)];
 
-		if (table_node) {
-			node = table_node;
-		} else {
-			thr = UT_LIST_GET_NEXT(thrs, thr);
-
-			if (!(++i % n_purge_threads)) {
-				thr = UT_LIST_GET_FIRST(
-					purge_sys.query->thrs);
-			}
-
-			ut_a(thr != NULL);
-			table_node = node;
+		if (!table.n_recs++) {
+			table.trx_no = trx_no;
 		}
 
-		node->undo_recs.push(purge_rec);
+		recs.emplace_back(purge_rec, &table);
 
 		if (n_pages_handled >= batch_size) {
 			break;
@@ -1171,6 +1281,62 @@ trx_purge_attach_undo_recs(ulint n_purge_threads)
 
 	ut_ad(purge_sys.head <= purge_sys.tail);
 
+	/* Distribute the records of each table that exceeds its fair
+	share of the batch to all tasks. The records of each row will
+	be processed by a single task, in order. */
+	std::vector<ulint> load(n_purge_threads);
+	std::vector<table_work*> whole;
+	whole.reserve(tables.size());
+
+	for (auto& t : tables) {
+		if (n_purge_threads > 1
+		    && t.second.n_recs * n_purge_threads > recs.size()
+		    && trx_purge_fold_cs(t.first, t.second.cs)) {
+			t.second.task = ULINT_UNDEFINED;
+			for (ulint& l : load) {
+				l += t.second.n_recs / n_purge_threads;
+			}
+		} else {
+			whole.push_back(&t.second);
+		}
+	}
+
+	/* Assign the other tables to the least loaded task,
+	largest first. */
+	std::sort(whole.begin(), whole.end(),
+		  [](const table_work* a, const table_work* b)
+		  { return a->n_recs > b->n_recs; });
+
+	for (table_work* t : whole) {
+		t->task = ulint(std::min_element(load.begin(), load.end())
+				- load.begin());
+		load[t->task] += t->n_recs;
+	}
+
+	for (auto& r : recs) {
+		table_work& t = *r.second;
+		const ulint task = t.task == ULINT_UNDEFINED
+			? trx_purge_rec_fold(r.first.undo_rec, t.cs)
+			% n_purge_threads
+			: t.task;
+		t.tasks |= 1U << task;
+		nodes[task]->undo_recs.push(r.first);
+	}
+
+	/* Keep the statistics of the previous batch if this one
+	found nothing to purge. */
+	if (!tables.empty()) {
+		purge_sys.stats_mutex.wr_lock();
+		purge_sys.batch_tables.clear();
+		for (const auto& t : tables) {
+			purge_sys.batch_tables.push_back(
+				{t.first, t.second.trx_no, t.second.n_recs,
+				 ulint(std::bitset<32>(t.second.tasks)
+				       .count())});
+		}
+		purge_sys.stats_mutex.wr_unlock();
+	}
+
 	return(n_pages_handled);
 }
 
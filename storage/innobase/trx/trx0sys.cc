@@ -204,6 +204,11 @@ void trx_sys_t::create()
   m_initialised= true;
   trx_list.create();
   rw_trx_hash.init();
+  m_rw_trx_hash_erased.store(0, std::memory_order_relaxed);
+  m_snapshot_latch.init();
+  m_snapshot.max_trx_id= 0;
+  m_snapshot.min_trx_no= 0;
+  m_snapshot.erased= 0;
 }
 
 uint32_t trx_sys_t::history_size()
@@ -387,6 +392,9 @@ trx_sys_t::close()
 	}
 
 	rw_trx_hash.destroy();
+	m_snapshot_latch.destroy();
+	m_snapshot.ids.clear();
+	m_snapshot.ids.shrink_to_fit();
 
 	/* There can't be any active transactions. */
 
@@ -45,6 +45,7 @@ Created 3/26/1996 Heikki Tuuri
 #include "trx0rseg.h"
 #include "trx0undo.h"
 #include "trx0xa.h"
+#include "row0merge.h"
 #include "ut0pool.h"
 #include "ut0vec.h"
 
@@ -1230,6 +1231,29 @@ void trx_t::evict_table(table_id_t table_id, bool reset_only)
 	}
 }
 
+trx_mod_table_time_t::~trx_mod_table_time_t()
+{
+  delete bulk_store;
+}
+
+/** Load the rows that were buffered for an insert into an empty table.
+The buffer is freed even if an error is returned.
+@param table        table that is being inserted to
+@param mysql_table  table handle for reporting duplicates, or nullptr
+@return error code */
+dberr_t trx_t::bulk_insert_apply(const dict_table_t &table,
+                                 struct TABLE *mysql_table)
+{
+  auto it= mod_tables.find(const_cast<dict_table_t*>(&table));
+  if (it == mod_tables.end() || !it->second.bulk_store)
+    return DB_SUCCESS;
+  row_merge_bulk_t *bulk= it->second.bulk_store;
+  it->second.bulk_store= nullptr;
+  dberr_t err= bulk->write_to_table(this, mysql_table);
+  delete bulk;
+  return err;
+}
+
 /** Mark a transaction committed in the main memory data structures. */
 inline void trx_t::commit_in_memory(const mtr_t *mtr)
 {
@@ -0,0 +1,95 @@
+/* Copyright (c) 2021, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/* Microbenchmark of group_commit_lock, which is used by log_write_up_to().
+Each thread performs "commits" that request a durable "log" up to a new
+sequence number; the group commit leader simulates an fsync. */
+
+#include <thread>
+#include "tap.h"
+#include "my_sys.h"
+#include "../log/log0sync.h"
+#include <mysql/service_thd_wait.h>
+
+void thd_wait_begin(MYSQL_THD, int) {}
+void thd_wait_end(MYSQL_THD) {}
+void ut_dbg_assertion_failed(const char *expr, const char *file, unsigned line)
+{
+  fprintf(stderr, "Assertion failure in file %s line %u: %s\n",
+          file, line, expr ? expr : "");
+  abort();
+}
+
+constexpr unsigned N_THREADS= 30;
+constexpr unsigned N_ROUNDS= 200;
+/** simulated fsync latency */
+constexpr std::chrono::microseconds FSYNC_TIME{500};
+/** upper limit of group_commit_lock::batch_delay(), in nanoseconds */
+constexpr ulonglong MAX_DELAY= 250000;
+
+static std::atomic<lsn_t> lsn;
+static std::atomic<bool> violation;
+static group_commit_lock flush_lock;
+
+static void test_group_commit()
+{
+  for (auto i= N_ROUNDS; i--; )
+  {
+    const lsn_t commit_lsn= lsn.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (flush_lock.acquire(commit_lsn, nullptr) ==
+        group_commit_lock::ACQUIRED)
+    {
+      flush_lock.batch_delay(MAX_DELAY);
+      const lsn_t flush_lsn= lsn.load(std::memory_order_relaxed);
+      flush_lock.set_pending(flush_lsn);
+      std::this_thread::sleep_for(FSYNC_TIME);
+      flush_lock.release(flush_lsn);
+    }
+    if (flush_lock.value() < commit_lsn)
+      violation= true;
+  }
+}
+
+int main(int argc __attribute__((unused)), char **argv)
+{
+  std::thread t[N_THREADS];
+
+  MY_INIT(argv[0]);
+
+  plan(2);
+
+  const ulonglong start= my_interval_timer();
+  for (auto i= N_THREADS; i--; )
+    t[i]= std::thread(test_group_commit);
+
+  for (auto i= N_THREADS; i--; )
+    t[i].join();
+  const ulonglong elapsed= my_interval_timer() - start;
+
+  ok(!violation, "group_commit_lock");
+  /* The threads overlap, so some requests must have been covered by
+  the simulated fsync of another thread. */
+  ok(flush_lock.requests() == N_THREADS * N_ROUNDS &&
+     flush_lock.batches() < flush_lock.requests(), "batching");
+
+  const size_t batches= flush_lock.batches();
+  diag("%zu commits, %zu flushes, average batch %zu, %llu commits/s",
+       flush_lock.requests(), batches,
+       batches ? flush_lock.requests() / batches : 0,
+       elapsed ? N_THREADS * N_ROUNDS * 1000000000ULL / elapsed : 0);
+
+  my_end(0);
+  return exit_status();
+}
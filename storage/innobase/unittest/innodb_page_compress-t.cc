@@ -0,0 +1,295 @@
+/* Copyright (c) 2021, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/* Round trip of fil_page_compress_low() and fil_page_decompress_low() for
+every innodb_compression_algorithm that was found at build time, with the
+compression ratio, the size on disk when the tail of each page is punched
+in file system blocks, and the compression and decompression speed.
+
+Without arguments, synthetic pages are used. Data files or page dumps of
+innodb_page_size pages can be compared instead:
+
+innodb_page_compress-t [-p page_size] [-b block_size] [-l level]
+                       [-r rounds] [file...] */
+
+#include <vector>
+#include "tap.h"
+#include "my_sys.h"
+#include "fil0pagecompress.h"
+#ifdef HAVE_LZO
+# include "lzo/lzo1x.h"
+#endif
+#ifdef HAVE_SNAPPY
+# include "snappy-c.h"
+#endif
+
+ulong srv_page_size= UNIV_PAGE_SIZE_DEF;
+
+ib::error::~error()
+{
+  fprintf(stderr, "%s\n", m_oss.str().c_str());
+}
+
+void ut_dbg_assertion_failed(const char *expr, const char *file, unsigned line)
+{
+  fprintf(stderr, "Assertion failure in file %s line %u: %s\n",
+          file, line, expr ? expr : "");
+  abort();
+}
+
+/** The header that is not compressed in the full_crc32 format */
+static constexpr size_t HEADER_LEN= FIL_PAGE_COMP_ALGO;
+
+/** Size of a buffer for fil_page_compress_low() */
+static size_t out_size;
+
+static size_t block_size= 4096;
+static unsigned level= 6;
+static unsigned rounds= 3;
+
+static const struct
+{
+  const char *name;
+  ulint algo;
+} algorithms[]=
+{
+  {"zlib", PAGE_ZLIB_ALGORITHM},
+#ifdef HAVE_LZ4
+  {"lz4", PAGE_LZ4_ALGORITHM},
+#endif
+#ifdef HAVE_LZO
+  {"lzo", PAGE_LZO_ALGORITHM},
+#endif
+#ifdef HAVE_LZMA
+  {"lzma", PAGE_LZMA_ALGORITHM},
+#endif
+#ifdef HAVE_BZIP2
+  {"bzip2", PAGE_BZIP2_ALGORITHM},
+#endif
+#ifdef HAVE_SNAPPY
+  {"snappy", PAGE_SNAPPY_ALGORITHM},
+#endif
+#ifdef HAVE_ZSTD
+  {"zstd", PAGE_ZSTD_ALGORITHM},
+#endif
+};
+
+/** @return whether the page consists of NUL bytes (was never written) */
+static bool is_zero_page(const byte *page)
+{
+  for (size_t i= 0; i < srv_page_size; i++)
+    if (page[i])
+      return false;
+  return true;
+}
+
+/** Read the non-empty pages of a file.
+@return whether the file could be read */
+static bool read_pages(const char *name, std::vector<byte> &pages)
+{
+  FILE *f= fopen(name, "rb");
+  if (!f)
+  {
+    perror(name);
+    return false;
+  }
+  std::vector<byte> page(srv_page_size);
+  while (fread(page.data(), srv_page_size, 1, f) == 1)
+    if (!is_zero_page(page.data()))
+      pages.insert(pages.end(), page.begin(), page.end());
+  bool ok= !ferror(f);
+  if (!ok)
+    perror(name);
+  fclose(f);
+  return ok;
+}
+
+/** Create pages that resemble index pages: records of a few columns,
+some of them repeating, followed by free space. */
+static void make_pages(std::vector<byte> &pages, size_t n_pages)
+{
+  static const char *const words[]=
+    {"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf"};
+  uint32_t rnd= 1;
+
+  pages.assign(n_pages * srv_page_size, 0);
+  for (size_t i= 0; i < n_pages; i++)
+  {
+    byte *page= &pages[i * srv_page_size];
+    byte *end= page + srv_page_size * (5 + i % 4) / 8;
+    mach_write_to_4(page + FIL_PAGE_OFFSET, uint32_t(i));
+    for (byte *rec= page + FIL_PAGE_DATA; rec + 64 < end; rec+= 64)
+    {
+      rnd= rnd * 1103515245 + 12345;
+      mach_write_to_4(rec, uint32_t(rec - page));
+      mach_write_to_8(rec + 4, i << 16 | size_t(rec - page));
+      mach_write_to_4(rec + 12, rnd);
+      snprintf(reinterpret_cast<char*>(rec + 16), 48, "%s %s %u",
+               words[(rnd >> 8) % 7], words[(rnd >> 12) % 7],
+               unsigned(rnd >> 20));
+    }
+  }
+}
+
+/** Compress and decompress the pages with an algorithm.
+@return whether every page was compressed and restored */
+static bool benchmark(const char *name, ulint algo,
+                      const std::vector<byte> &pages)
+{
+  const size_t n_pages= pages.size() / srv_page_size;
+  std::vector<byte> out(n_pages * out_size);
+  std::vector<size_t> len(n_pages);
+  std::vector<byte> page(srv_page_size);
+
+  ulonglong compress_ns= 0, decompress_ns= 0;
+  for (unsigned r= rounds; r--; )
+  {
+    const ulonglong start= my_interval_timer();
+    for (size_t i= 0; i < n_pages; i++)
+      len[i]= fil_page_compress_low(&pages[i * srv_page_size],
+                                    &out[i * out_size], HEADER_LEN,
+                                    algo, level);
+    compress_ns+= my_interval_timer() - start;
+  }
+
+  size_t n_compressed= 0, errors= 0;
+  ulonglong compressed= 0, on_disk= 0;
+  for (size_t i= 0; i < n_pages; i++)
+  {
+    if (!len[i])
+    {
+      compressed+= srv_page_size;
+      on_disk+= srv_page_size;
+      continue;
+    }
+    const size_t size= HEADER_LEN + len[i] + FIL_PAGE_FCRC32_CHECKSUM;
+    n_compressed++;
+    compressed+= size;
+    on_disk+= std::min<size_t>(srv_page_size,
+                               (size + block_size - 1) & ~(block_size - 1));
+  }
+
+  for (unsigned r= rounds; r--; )
+  {
+    const ulonglong start= my_interval_timer();
+    for (size_t i= 0; i < n_pages; i++)
+      if (len[i] &&
+          !fil_page_decompress_low(page.data(), &out[i * out_size], algo,
+                                   HEADER_LEN, len[i]))
+        errors++;
+    decompress_ns+= my_interval_timer() - start;
+  }
+
+  for (size_t i= 0; i < n_pages; i++)
+    if (len[i] &&
+        (!fil_page_decompress_low(page.data(), &out[i * out_size], algo,
+                                  HEADER_LEN, len[i]) ||
+         memcmp(page.data(), &pages[i * srv_page_size], srv_page_size)))
+      errors++;
+
+  const double total= double(n_pages) * double(srv_page_size) * rounds;
+  diag("%-8s %8zu %9.1f%% %7.2f %8.2f %10.1f %12.1f", name, n_pages,
+       100.0 * double(n_compressed) / double(n_pages),
+       double(n_pages * srv_page_size) / double(compressed),
+       double(n_pages * srv_page_size) / double(on_disk),
+       compress_ns ? total * 1000 / double(compress_ns) : 0.0,
+       decompress_ns && n_compressed
+       ? double(n_compressed) * double(srv_page_size) * rounds * 1000 /
+       double(decompress_ns) : 0.0);
+
+  return !errors && n_compressed;
+}
+
+static void usage(const char *progname)
+{
+  fprintf(stderr,
+          "Usage: %s [-p page_size] [-b block_size] [-l level]"
+          " [-r rounds] [file...]\n", progname);
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  MY_INIT(argv[0]);
+
+  int i= 1;
+  for (; i < argc && argv[i][0] == '-'; i++)
+  {
+    if (i + 1 == argc || argv[i][2])
+      usage(argv[0]);
+    long value= atol(argv[++i]);
+    switch (argv[i - 1][1]) {
+    case 'p':
+      if (value < UNIV_PAGE_SIZE_MIN || value > UNIV_PAGE_SIZE_MAX ||
+          (value & (value - 1)))
+        usage(argv[0]);
+      srv_page_size= ulong(value);
+      break;
+    case 'b':
+      if (value < 512 || (value & (value - 1)))
+        usage(argv[0]);
+      block_size= size_t(value);
+      break;
+    case 'l':
+      if (value < 1 || value > 9)
+        usage(argv[0]);
+      level= unsigned(value);
+      break;
+    case 'r':
+      if (value < 1)
+        usage(argv[0]);
+      rounds= unsigned(value);
+      break;
+    default:
+      usage(argv[0]);
+    }
+  }
+
+  std::vector<byte> pages;
+  if (i == argc)
+    make_pages(pages, 32);
+  for (; i < argc; i++)
+    if (!read_pages(argv[i], pages))
+      return 1;
+
+  if (pages.empty())
+  {
+    fprintf(stderr, "No pages were found\n");
+    return 1;
+  }
+
+  /* As in buf_tmp_reserve_compression_buf(). snappy may write up to
+  snappy_max_compressed_length() bytes after the header. */
+  out_size= srv_page_size;
+#ifdef HAVE_LZO
+  out_size+= LZO1X_1_15_MEM_COMPRESS;
+#endif
+#ifdef HAVE_SNAPPY
+  out_size= std::max(out_size, HEADER_LEN +
+                     snappy_max_compressed_length(srv_page_size));
+#endif
+
+  plan(sizeof algorithms / sizeof *algorithms);
+
+  diag("page_size=%lu block_size=%zu level=%u rounds=%u",
+       srv_page_size, block_size, level, rounds);
+  diag("%-8s %8s %10s %7s %8s %10s %12s", "algo", "pages",
+       "compressed", "ratio", "on disk", "comp MB/s", "decomp MB/s");
+  for (const auto &a : algorithms)
+    ok(benchmark(a.name, a.algo, pages), "%s", a.name);
+
+  my_end(0);
+  return exit_status();
+}
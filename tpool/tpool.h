@@ -117,7 +117,7 @@ enum class aio_opcode
   AIO_PREAD,
   AIO_PWRITE
 };
-constexpr size_t MAX_AIO_USERDATA_LEN= 3 * sizeof(void*);
+constexpr size_t MAX_AIO_USERDATA_LEN= 2 * sizeof(void*) + 8;
 
 /** IO control block, includes parameters for the IO, and the callback*/
 
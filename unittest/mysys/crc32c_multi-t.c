@@ -0,0 +1,116 @@
+/* Copyright (c) MariaDB 2021
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU General Public License as
+   published by the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful, but
+   WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <tap.h>
+#include <string.h>
+
+/*
+  Check my_crc32c() against a bitwise implementation, check that
+  my_crc32c_multi() returns the same result as my_crc32c() for each buffer,
+  and compare the throughput of the two on a batch of 16KiB pages,
+  like the ones that InnoDB verifies on read.
+*/
+
+#define PAGE_SIZE 16384
+#define N_PAGES 64
+#define ROUNDS 200
+
+static uchar buf[N_PAGES * PAGE_SIZE];
+
+/* Bitwise CRC-32C, for validating the optimized implementations */
+static uint32 crc32c_ref(uint32 crc, const uchar *p, size_t size)
+{
+  crc= ~crc;
+  while (size--)
+  {
+    int i;
+    crc^= *p++;
+    for (i= 0; i < 8; i++)
+      crc= (crc >> 1) ^ (0x82F63B78 & (0U - (crc & 1)));
+  }
+  return ~crc;
+}
+
+static my_bool check_ref(void)
+{
+  size_t size;
+  for (size= 0; size < 2000; size+= 7)
+    if (my_crc32c((uint32) size, buf + size % 61, size) !=
+        crc32c_ref((uint32) size, buf + size % 61, size))
+      return FALSE;
+  return my_crc32c(0, buf, PAGE_SIZE) == crc32c_ref(0, buf, PAGE_SIZE);
+}
+
+static my_bool check(size_t size, size_t stride, size_t n)
+{
+  uint32 crc[N_PAGES];
+  size_t i;
+  for (i= 0; i < n; i++)
+    crc[i]= (uint32) i;
+  my_crc32c_multi(crc, buf, size, stride, n);
+  for (i= 0; i < n; i++)
+    if (crc[i] != my_crc32c((uint32) i, buf + i * stride, size))
+      return FALSE;
+  return TRUE;
+}
+
+int main(int argc __attribute__((unused)),char *argv[])
+{
+  uint32 crc[N_PAGES];
+  ulonglong start, single, multi;
+  size_t i, round;
+  uint32 sum= 0;
+
+  MY_INIT(argv[0]);
+  plan(7);
+  diag("%s", my_crc32c_implementation());
+
+  for (i= 0; i < sizeof buf; i++)
+    buf[i]= (uchar) (i * 2654435761U >> 13);
+
+  ok(check_ref(), "my_crc32c matches the bitwise implementation");
+  ok(check(0, PAGE_SIZE, N_PAGES), "empty buffers");
+  ok(check(PAGE_SIZE - 4, PAGE_SIZE, 1), "one page");
+  ok(check(PAGE_SIZE - 4, PAGE_SIZE, 7), "7 pages");
+  ok(check(PAGE_SIZE - 4, PAGE_SIZE, N_PAGES), "%d pages", N_PAGES);
+  ok(check(13, 17, N_PAGES), "unaligned buffers");
+
+  start= my_interval_timer();
+  for (round= 0; round < ROUNDS; round++)
+    for (i= 0; i < N_PAGES; i++)
+      sum^= my_crc32c(0, buf + i * PAGE_SIZE, PAGE_SIZE - 4);
+  single= my_interval_timer() - start;
+
+  start= my_interval_timer();
+  for (round= 0; round < ROUNDS; round++)
+  {
+    memset(crc, 0, sizeof crc);
+    my_crc32c_multi(crc, buf, PAGE_SIZE - 4, PAGE_SIZE, N_PAGES);
+    for (i= 0; i < N_PAGES; i++)
+      sum^= crc[i];
+  }
+  multi= my_interval_timer() - start;
+
+  /* Every page was checksummed an even number of times. */
+  ok(sum == 0, "benchmark checksums match");
+  diag("my_crc32c: %llu MB/s, my_crc32c_multi: %llu MB/s",
+       (ulonglong) ROUNDS * sizeof buf * 1000 / (single + 1),
+       (ulonglong) ROUNDS * sizeof buf * 1000 / (multi + 1));
+
+  my_end(0);
+  return exit_status();
+}